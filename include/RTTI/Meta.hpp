@@ -12,6 +12,7 @@
 #include "../../source/MetaTrait.inl"
 #include "../../source/MetaVerb.inl"
 #include "../../source/MetaConst.inl"
+#include "../../source/DispatchSite.hpp"
 #include "../../source/Tag.hpp"
 #include "../../source/Arithmetic.hpp"
 
@@ -0,0 +1,113 @@
+///                                                                           
+/// Langulus::RTTI                                                            
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "MetaData.inl"
+#include "MetaVerb.inl"
+
+
+namespace Langulus::RTTI
+{
+
+   ///                                                                        
+   ///   Inline cache of verb dispatches at a single call site                
+   ///                                                                        
+   /// Remembers the abilities of the last few receiver and argument types    
+   /// it dispatched, so that dispatching the same types again doesn't search 
+   /// the ability table at all. When full, entries are replaced in turn. The 
+   /// cache is cleared whenever a boundary is unloaded                       
+   ///   @attention not thread-safe, keep a site per thread or per interpreter
+   ///   @tparam MUTABLE - whether to dispatch mutable/immutable overloads    
+   ///   @tparam WAYS - number of remembered receiver/argument pairs          
+   ///                                                                        
+   template<bool MUTABLE, Count WAYS = 4>
+   class DispatchSite {
+      static_assert(WAYS > 0, "Dispatch site must remember at least one type");
+
+   public:
+      using Function = Conditional<MUTABLE, FVerbMutable, FVerbConstant>;
+
+   private:
+      struct Entry {
+         const MetaData* mType;
+         const MetaData* mArgument;
+         Function mFunction;
+      };
+
+      // The verb dispatched at this site                               
+      VMeta mVerb;
+      // Remembered dispatches, the first mCount of them are valid      
+      Entry mEntries[WAYS] {};
+      Count mCount = 0;
+      // The entry to replace next, when all of them are valid          
+      Count mNext = 0;
+      // The registry epoch the entries were remembered in              
+      Count mEpoch = 0;
+      // Statistics                                                     
+      Count mHits = 0;
+      Count mMisses = 0;
+
+   public:
+      constexpr DispatchSite() noexcept = default;
+      explicit DispatchSite(VMeta verb) noexcept
+         : mVerb {verb} {}
+
+      NOD() Function Get(DMeta, DMeta = {});
+
+      NOD() VMeta GetVerb() const noexcept { return mVerb; }
+      NOD() Count GetHits() const noexcept { return mHits; }
+      NOD() Count GetMisses() const noexcept { return mMisses; }
+      NOD() Count GetCount() const noexcept { return mCount; }
+
+      void Reset() noexcept;
+   };
+
+   /// Get the overload of the site's verb, for a receiver and argument type  
+   ///   @param type - the type of the receiver                               
+   ///   @param argument - the type of the verb's argument (optional)         
+   ///   @return the overload, or nullptr if receiver can't do the verb       
+   template<bool MUTABLE, Count WAYS>
+   auto DispatchSite<MUTABLE, WAYS>::Get(DMeta type, DMeta argument) -> Function {
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
+
+      if (mEpoch != epoch) {
+         // Remembered definitions might have been unloaded             
+         mCount = mNext = 0;
+         mEpoch = epoch;
+      }
+
+      const auto t = type.operator -> ();
+      const auto a = argument.operator -> ();
+      for (Count i = 0; i < mCount; ++i) {
+         const auto& entry = mEntries[i];
+         if (entry.mType == t and entry.mArgument == a) {
+            ++mHits;
+            return entry.mFunction;
+         }
+      }
+
+      ++mMisses;
+      const Function function = type
+         ? type->template GetAbility<MUTABLE>(mVerb, argument) : Function {};
+
+      auto& entry = mCount < WAYS ? mEntries[mCount++] : mEntries[mNext++ % WAYS];
+      entry = {t, a, function};
+      return function;
+   }
+
+   /// Forget all remembered dispatches and statistics                        
+   template<bool MUTABLE, Count WAYS> LANGULUS(INLINED)
+   void DispatchSite<MUTABLE, WAYS>::Reset() noexcept {
+      mCount = mNext = mEpoch = mHits = mMisses = 0;
+   }
+
+} // namespace Langulus::RTTI
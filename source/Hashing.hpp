@@ -36,6 +36,72 @@ namespace Langulus
       return lc;
    }
 
+   /// Lowercase a single ASCII character, without consulting the locale      
+   ///   @param c - the character to lowercase                                
+   ///   @return the lowercase character                                      
+   NOD() LANGULUS(INLINED) constexpr char ToLowercase(char c) noexcept {
+      return (c >= 'A' and c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+   }
+
+   /// Find a token inside another token, ignoring case                       
+   ///   @param haystack - the token to search in                             
+   ///   @param needle - the token to search for                              
+   ///   @return true if needle is contained inside haystack                  
+   NOD() LANGULUS(INLINED)
+   constexpr bool ContainsCaseInsensitive(const Token& haystack, const Token& needle) noexcept {
+      if (needle.size() > haystack.size())
+         return false;
+
+      const auto end = haystack.size() - needle.size();
+      for (size_t i = 0; i <= end; ++i) {
+         size_t j = 0;
+         while (j < needle.size()
+         and ToLowercase(haystack[i + j]) == ToLowercase(needle[j]))
+            ++j;
+         if (j == needle.size())
+            return true;
+      }
+      return false;
+   }
+
+   ///                                                                        
+   ///   Case-insensitive token hasher                                        
+   ///   Transparent, so any token-like key can be searched without making a  
+   /// lowercase copy of it first                                             
+   ///                                                                        
+   struct CaseInsensitiveHash {
+      using is_transparent = void;
+
+      NOD() LANGULUS(INLINED)
+      constexpr size_t operator () (const Token& token) const noexcept {
+         // FNV-1a over the case-folded characters                      
+         uint64_t h = 14695981039346656037ULL;
+         for (auto c : token) {
+            h ^= static_cast<unsigned char>(ToLowercase(c));
+            h *= 1099511628211ULL;
+         }
+         return static_cast<size_t>(h);
+      }
+   };
+
+   ///                                                                        
+   ///   Case-insensitive token comparer, counterpart of CaseInsensitiveHash  
+   ///                                                                        
+   struct CaseInsensitiveEqual {
+      using is_transparent = void;
+
+      NOD() LANGULUS(INLINED)
+      constexpr bool operator () (const Token& lhs, const Token& rhs) const noexcept {
+         if (lhs.size() != rhs.size())
+            return false;
+         for (size_t i = 0; i < lhs.size(); ++i) {
+            if (ToLowercase(lhs[i]) != ToLowercase(rhs[i]))
+               return false;
+         }
+         return true;
+      }
+   };
+
    /// Default hash seed used in Langulus                                     
    constexpr uint32_t DefaultHashSeed = 19890212;
 
@@ -10,11 +10,18 @@
 #include "NameOf.hpp"
 #include <Core/Utilities.hpp>
 #include <vector>
+#include <atomic>
 
 
 namespace Langulus::RTTI
 {
 
+   /// Kind of a meta definition, stored in the definition itself, so that    
+   /// AMeta can be converted and compared without dynamic_cast               
+   enum class MetaKind : ::std::uint8_t {
+      Data, Trait, Verb, Constant
+   };
+
    ///                                                                        
    ///   Meta                                                                 
    ///                                                                        
@@ -26,9 +33,9 @@ namespace Langulus::RTTI
       LANGULUS(UNALLOCATABLE) true;
 
       Meta() = delete;
-      Meta(const Token&);
+      Meta(const Token&, MetaKind);
 
-      /// Virtual destructor required for dynamic_cast                        
+      /// Virtual, so the arena can destroy any definition through AMeta      
       virtual ~Meta() = default;
 
       virtual Token Kind() const noexcept = 0;
@@ -46,10 +53,27 @@ namespace Langulus::RTTI
       // Each reflected type has an unique hash                         
       // First for immediate access                                     
       const Hash mHash;
+      // The kind of the definition, never changes                      
+      const MetaKind mKind;
       // Each reflection primitive has a unique token, but that         
       // uniqueness is checked only if MANAGED_REFLECTION feature is    
       // enabled                                                        
       const Token mToken;
+      // The same type might be reflected in multiple boundaries, and   
+      // all those definitions point to the first one registered, so    
+      // that they can be compared by pointer. Set before a definition  
+      // is published, and later only stored atomically by the registry 
+      // if the boundary of that first definition is unloaded. Not      
+      // copied by operator =                                           
+      alignas(::std::atomic_ref<const Meta*>::required_alignment)
+      mutable const Meta* mCanonical = this;
+
+      /// Get the canonical definition of the same token                      
+      NOD() LANGULUS(INLINED)
+      const Meta* GetCanonical() const noexcept {
+         return ::std::atomic_ref<const Meta*> {mCanonical}
+            .load(::std::memory_order_relaxed);
+      }
 
       // Each reflection may or may not have some info                  
       Token mInfo = "<no info provided>";
@@ -65,6 +89,16 @@ namespace Langulus::RTTI
          // definitions when module is unloaded                         
          Token mLibraryName;
 
+         // Cached result of GetShortestUnambiguousToken, encoded as an 
+         // offset into mToken, or as one of the special values below.  
+         // The registry resets it whenever the set of definitions that 
+         // share the same last token changes                           
+         alignas(::std::atomic_ref<uint32_t>::required_alignment)
+         mutable uint32_t mShortestToken = ShortestTokenNotCached;
+
+         static constexpr uint32_t ShortestTokenNotCached = ~uint32_t {0};
+         static constexpr uint32_t ShortestTokenSanitized = ~uint32_t {0} - 1;
+
          NOD() LANGULUS_API(RTTI)
          Token GetShortestUnambiguousToken() const;
       #endif
@@ -80,8 +114,8 @@ namespace Langulus::RTTI
    ///                                                                        
    ///   Abstract definition interchange format                               
    ///                                                                        
-   /// Can contain DMeta, TMeta, VMeta or CMeta, which are dynamical_cast     
-   /// on demand to the appropriate type                                      
+   /// Can contain DMeta, TMeta, VMeta or CMeta, which are cast on demand to  
+   /// the appropriate type, depending on the definition's MetaKind           
    ///                                                                        
    struct AMeta {
       LANGULUS(POD) true;
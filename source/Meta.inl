@@ -178,30 +178,28 @@ namespace Langulus::RTTI
    #endif
    }
 
+   /// Compare two definitions of any kind                                    
+   ///   @return true if both are of the same kind, and match exactly         
    constexpr bool AMeta::operator == (const AMeta& rhs) const noexcept {
       if (mMeta == rhs.mMeta)
          return true;
-
-      const DMeta lhs_dmeta = dynamic_cast<const MetaData*>(mMeta);
-      const DMeta rhs_dmeta = dynamic_cast<const MetaData*>(rhs.mMeta);
-      if (lhs_dmeta and rhs_dmeta)
-         return lhs_dmeta == rhs_dmeta;
-
-      const TMeta lhs_tmeta = dynamic_cast<const MetaTrait*>(mMeta);
-      const TMeta rhs_tmeta = dynamic_cast<const MetaTrait*>(rhs.mMeta);
-      if (lhs_tmeta and rhs_tmeta)
-         return lhs_tmeta == rhs_tmeta;
-
-      const VMeta lhs_vmeta = dynamic_cast<const MetaVerb*>(mMeta);
-      const VMeta rhs_vmeta = dynamic_cast<const MetaVerb*>(rhs.mMeta);
-      if (lhs_vmeta and rhs_vmeta)
-         return lhs_vmeta == rhs_vmeta;
-
-      const CMeta lhs_cmeta = dynamic_cast<const MetaConst*>(mMeta);
-      const CMeta rhs_cmeta = dynamic_cast<const MetaConst*>(rhs.mMeta);
-      if (lhs_cmeta and rhs_cmeta)
-         return lhs_cmeta == rhs_cmeta;
-
+      if (not mMeta or not rhs.mMeta or mMeta->mKind != rhs.mMeta->mKind)
+         return false;
+
+      switch (mMeta->mKind) {
+      case MetaKind::Data:
+         return DMeta {static_cast<const MetaData*>(mMeta)}
+             == DMeta {static_cast<const MetaData*>(rhs.mMeta)};
+      case MetaKind::Trait:
+         return TMeta {static_cast<const MetaTrait*>(mMeta)}
+             == TMeta {static_cast<const MetaTrait*>(rhs.mMeta)};
+      case MetaKind::Verb:
+         return VMeta {static_cast<const MetaVerb*>(mMeta)}
+             == VMeta {static_cast<const MetaVerb*>(rhs.mMeta)};
+      case MetaKind::Constant:
+         return CMeta {static_cast<const MetaConst*>(mMeta)}
+             == CMeta {static_cast<const MetaConst*>(rhs.mMeta)};
+      }
       return false;
    }
    
@@ -209,8 +207,8 @@ namespace Langulus::RTTI
       if (mMeta == rhs.mMeta)
          return true;
 
-      const DMeta lhs_dmeta = dynamic_cast<const MetaData*>(mMeta);
-      const DMeta rhs_dmeta = dynamic_cast<const MetaData*>(rhs.mMeta);
+      const auto lhs_dmeta = As<DMeta>();
+      const auto rhs_dmeta = rhs.As<DMeta>();
       if (lhs_dmeta and rhs_dmeta)
          return lhs_dmeta & rhs_dmeta;
 
@@ -221,8 +219,8 @@ namespace Langulus::RTTI
       if (mMeta == rhs.mMeta)
          return true;
 
-      const DMeta lhs_dmeta = dynamic_cast<const MetaData*>(mMeta);
-      const DMeta rhs_dmeta = dynamic_cast<const MetaData*>(rhs.mMeta);
+      const auto lhs_dmeta = As<DMeta>();
+      const auto rhs_dmeta = rhs.As<DMeta>();
       if (lhs_dmeta and rhs_dmeta)
          return lhs_dmeta | rhs_dmeta;
 
@@ -233,10 +231,9 @@ namespace Langulus::RTTI
       if (mMeta == static_cast<const Meta*>(rhs.mMeta))
          return true;
 
-      const VMeta lhs_vmeta = dynamic_cast<const MetaVerb*>(mMeta);
-      const VMeta rhs_vmeta = dynamic_cast<const MetaVerb*>(rhs.mMeta);
-      if (lhs_vmeta and rhs_vmeta)
-         return lhs_vmeta == rhs_vmeta;
+      const auto lhs_vmeta = As<VMeta>();
+      if (lhs_vmeta and rhs)
+         return lhs_vmeta == rhs;
 
       return false;
    }
@@ -245,10 +242,9 @@ namespace Langulus::RTTI
       if (mMeta == static_cast<const Meta*>(rhs.mMeta))
          return true;
 
-      const TMeta lhs_tmeta = dynamic_cast<const MetaTrait*>(mMeta);
-      const TMeta rhs_tmeta = dynamic_cast<const MetaTrait*>(rhs.mMeta);
-      if (lhs_tmeta and rhs_tmeta)
-         return lhs_tmeta == rhs_tmeta;
+      const auto lhs_tmeta = As<TMeta>();
+      if (lhs_tmeta and rhs)
+         return lhs_tmeta == rhs;
 
       return false;
    }
@@ -257,45 +253,55 @@ namespace Langulus::RTTI
       if (mMeta == static_cast<const Meta*>(rhs.mMeta))
          return true;
 
-      const CMeta lhs_cmeta = dynamic_cast<const MetaConst*>(mMeta);
-      const CMeta rhs_cmeta = dynamic_cast<const MetaConst*>(rhs.mMeta);
-      if (lhs_cmeta and rhs_cmeta)
-         return lhs_cmeta == rhs_cmeta;
+      const auto lhs_cmeta = As<CMeta>();
+      if (lhs_cmeta and rhs)
+         return lhs_cmeta == rhs;
 
       return false;
    }
 
    LANGULUS(INLINED)
    constexpr bool AMeta::operator == (const DMeta& rhs) const noexcept {
-      const DMeta lhs_dmeta = dynamic_cast<const MetaData*>(mMeta);
+      const auto lhs_dmeta = As<DMeta>();
       return lhs_dmeta ? lhs_dmeta == rhs : false;
    }
 
    LANGULUS(INLINED)
    constexpr bool AMeta::operator & (const DMeta& rhs) const noexcept {
-      const DMeta lhs_dmeta = dynamic_cast<const MetaData*>(mMeta);
+      const auto lhs_dmeta = As<DMeta>();
       return lhs_dmeta ? lhs_dmeta & rhs : false;
    }
 
    LANGULUS(INLINED)
    constexpr bool AMeta::operator | (const DMeta& rhs) const noexcept {
-      const DMeta lhs_dmeta = dynamic_cast<const MetaData*>(mMeta);
+      const auto lhs_dmeta = As<DMeta>();
       return lhs_dmeta ? lhs_dmeta | rhs : false;
    }
 
+   /// Convert to a specific definition interchange type                      
+   ///   @tparam T - the type to convert to                                   
+   ///   @return the definition, or nullptr if it is of a different kind      
    template<class T> LANGULUS(INLINED)
    constexpr T AMeta::As() const noexcept {
       if (not mMeta)
          return {};
 
-      if constexpr (CT::Exact<T, DMeta>)
-         return dynamic_cast<const MetaData*>(mMeta);
-      else if constexpr (CT::Exact<T, TMeta>)
-         return dynamic_cast<const MetaTrait*>(mMeta);
-      else if constexpr (CT::Exact<T, VMeta>)
-         return dynamic_cast<const MetaVerb*>(mMeta);
-      else if constexpr (CT::Exact<T, CMeta>)
-         return dynamic_cast<const MetaConst*>(mMeta);
+      if constexpr (CT::Exact<T, DMeta>) {
+         return mMeta->mKind == MetaKind::Data
+            ? static_cast<const MetaData*>(mMeta) : nullptr;
+      }
+      else if constexpr (CT::Exact<T, TMeta>) {
+         return mMeta->mKind == MetaKind::Trait
+            ? static_cast<const MetaTrait*>(mMeta) : nullptr;
+      }
+      else if constexpr (CT::Exact<T, VMeta>) {
+         return mMeta->mKind == MetaKind::Verb
+            ? static_cast<const MetaVerb*>(mMeta) : nullptr;
+      }
+      else if constexpr (CT::Exact<T, CMeta>) {
+         return mMeta->mKind == MetaKind::Constant
+            ? static_cast<const MetaConst*>(mMeta) : nullptr;
+      }
       else if constexpr (CT::Exact<T, AMeta>)
          return *this;
       else static_assert(false,
@@ -328,23 +334,26 @@ namespace Langulus::RTTI
       if (not mMeta)
          return Meta::Unknown;
 
-      if (dynamic_cast<const MetaData*>(mMeta))
+      switch (mMeta->mKind) {
+      case MetaKind::Data:
          return Meta::Data;
-      else if (dynamic_cast<const MetaTrait*>(mMeta))
+      case MetaKind::Trait:
          return Meta::Trait;
-      else if (dynamic_cast<const MetaVerb*>(mMeta))
+      case MetaKind::Verb:
          return Meta::Verb;
-      else if (dynamic_cast<const MetaConst*>(mMeta))
+      case MetaKind::Constant:
          return Meta::Constant;
-      else 
-         return Meta::Unknown;
+      }
+      return Meta::Unknown;
    }
    
    /// Construct an abstract meta definition by setting token and hashing it  
    ///   @param name - token                                                  
+   ///   @param kind - the kind of the definition                             
    LANGULUS(INLINED)
-   Meta::Meta(const Token& name)
+   Meta::Meta(const Token& name, MetaKind kind)
       : mHash  {HashOf(name)}
+      , mKind  {kind}
       , mToken {name} {}
 
 } // namespace Langulus::RTTI
\ No newline at end of file
@@ -26,7 +26,7 @@ namespace Langulus::RTTI
       const void* mPtrToValue {};
 
    public:
-      MetaConst(const Token& token) : Meta {token} {}
+      MetaConst(const Token& token) : Meta {token, MetaKind::Constant} {}
 
       template<CT::Decayed>
       NOD() static CMeta Of();
@@ -10,6 +10,9 @@
 #include "MetaVerb.hpp"
 #include "MetaTrait.hpp"
 #include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
 
 
 namespace Langulus::RTTI
@@ -58,6 +61,24 @@ namespace Langulus::RTTI
    /// The move/abandon-assignment operator, wrapped in a lambda expression   
    using FMove = void(*)(void* from, void* to);
 
+   /// Batched counterparts of the functions above, that operate on a         
+   /// number of instances laid out one after another, so that containers     
+   /// make a single call for all of them. For POD types they reduce to       
+   /// memset/memcpy/memcmp, and to tight loops otherwise. Just like the      
+   /// single-instance functions, they always work with the origin type -     
+   /// qualified and pointer variants inherit them from it as they are        
+   using FDefaultConstructN = void(*)(void* at, Count);
+   using FCopyConstructN = void(*)(const void* from, void* to, Count);
+   using FMoveConstructN = void(*)(void* from, void* to, Count);
+   using FDestroyN = void(*)(void* at, Count);
+   using FCompareN = bool(*)(const void*, const void*, Count);
+   using FCopyN = void(*)(const void* from, void* to, Count);
+   using FMoveN = void(*)(void* from, void* to, Count);
+
+   /// Batched relocation, moves instances to new memory, and ends the        
+   /// lifetime of the old ones. The memory is allowed to overlap             
+   using FRelocateN = void(*)(void* from, void* to, Count);
+
    /// The class type function, wrapped in a lambda expression                
    /// Returns the typed memory block of the class instance                   
    using FResolve = Anyness::Block<>(*)(const void*);
@@ -66,6 +87,8 @@ namespace Langulus::RTTI
    /// Takes the pointer to the instance for hashing                          
    /// Returns the hash                                                       
    using FHash = Hash(*)(const void*);
+   /// Batched hasher, writes the hash of each instance in the output array   
+   using FHashN = void(*)(const void*, Count, Hash*);
    
    /// The reference function wrapped in a lambda                             
    /// Takes the pointer to the instance for referencing                      
@@ -95,6 +118,8 @@ namespace Langulus::RTTI
       LANGULUS(UNALLOCATABLE) true;
       LANGULUS(ACT_AS)        void;
 
+      static constexpr Offset NoOffset = static_cast<Offset>(-1);
+
       // Type of data                                                   
       // We can't get at reflection time, so we generate a lambda that  
       // retrieves it when required                                     
@@ -102,13 +127,32 @@ namespace Langulus::RTTI
       // Get pointer to the member. Assumes argument points to an       
       // instance of the member owner.                                  
       FDynamicCast mValueRetriever {};
+      // Byte offset of the member, relative to the owner. Computed at  
+      // reflection time, so that Get() is just pointer arithmetic.     
+      // NoOffset if member is reachable only through mValueRetriever   
+      Offset mOffset = NoOffset;
       // Number of elements in mData (in case of an array)              
       Count mCount = 1;
-      // Trait tag                                                      
+      // Trait tags                                                     
       // We can't get at reflection time, so we generate a lambda that  
-      // retrieves it when required (TODO this is the first tag only)   
+      // retrieves the tag with the given index, when required          
       FTraitRetriever mTraitRetriever {};
 
+   private:
+      // The type and first trait tag, as returned by the retrievers    
+      // on first use, and again only after a boundary was unloaded     
+      // since. mResolvedEpoch is zero while they're being written,     
+      // so that readers never need to lock. Only the first tag is      
+      // cached, because most members have a single one, and lookups    
+      // by any tag go through the MetaData's member table, which       
+      // resolves all of them once                                      
+      alignas(::std::atomic_ref<Count>::required_alignment)
+      mutable Count mResolvedEpoch = 0;
+      alignas(::std::atomic_ref<const Meta*>::required_alignment)
+      mutable const Meta* mResolvedType = nullptr;
+      alignas(::std::atomic_ref<const Meta*>::required_alignment)
+      mutable const Meta* mResolvedTrait = nullptr;
+
    public:
       constexpr Member() noexcept = default;
       constexpr Member(const Member&) noexcept = default;
@@ -117,7 +161,7 @@ namespace Langulus::RTTI
 
       Member& operator = (const Member&) noexcept = default;
 
-      NOD() bool operator == (const Member&) const noexcept;
+      NOD() bool operator == (const Member&) const;
       
       template<CT::Data T>
       NOD() auto As(const Byte*) const noexcept -> T const&;
@@ -131,12 +175,71 @@ namespace Langulus::RTTI
       NOD() TMeta GetTrait(int) const;
 
    private:
+      void Resolve(DMeta&, TMeta&) const;
+
       template<class...T>
       static TMeta TraitSelector(int, Types<T...>&&);
    };
 
    using MemberList = ::std::vector<Member>;
 
+   ///                                                                        
+   ///   A member of a type or of any of its bases, with its type, traits     
+   ///   and absolute offset resolved in advance                              
+   ///                                                                        
+   struct ResolvedMember {
+      // The reflected member                                           
+      const Member* mMember {};
+      // The resolved type of the member                                
+      DMeta mType {};
+      // All trait tags of the member, in order                         
+      ::std::vector<TMeta> mTraits {};
+      // Byte offset of the member, relative to the type that has it,   
+      // including the offsets of all bases on the way. NoOffset if     
+      // reachable only through a virtual base, or mValueRetriever      
+      Offset mOffset = Member::NoOffset;
+
+   public:
+      NOD() bool HasTrait(TMeta) const noexcept;
+   };
+
+   ///                                                                        
+   ///   All members of a type, including inherited ones, indexed by the      
+   ///   hashes of their traits and types                                     
+   ///                                                                        
+   struct MemberTable {
+      // Hashes paired with indices in mMembers, sorted                 
+      using Index = ::std::vector<::std::pair<::std::size_t, Count>>;
+
+      // Members of all bases first, in order, then the local ones      
+      ::std::vector<ResolvedMember> mMembers {};
+      // Each trait of each member, by the hash of the trait            
+      Index mByTrait {};
+      // Each member, by the hash of its decayed type                   
+      Index mByType {};
+      // The registry epoch the table was built in, or zero if it was   
+      // built before the type and all its bases were reflected         
+      Count mEpoch = 0;
+   };
+
+   ///                                                                        
+   ///   Member tables of a type, built on first use in each registry epoch   
+   ///   Never copied along with the type, because copies are qualified or    
+   /// sparse variants, that always use the tables of their origin            
+   ///                                                                        
+   struct MemberTables {
+      // The table built in the latest epoch, or nullptr                
+      alignas(::std::atomic_ref<const MemberTable*>::required_alignment)
+      const MemberTable* mLatest {};
+      // All tables built so far - a replaced one might still be in use 
+      // by another thread, so it is kept until the type is destroyed   
+      ::std::vector<::std::unique_ptr<const MemberTable>> mBuilt {};
+
+      MemberTables() = default;
+      MemberTables(const MemberTables&) noexcept {}
+      MemberTables& operator = (const MemberTables&) noexcept { return *this; }
+   };
+
    
    ///                                                                        
    ///   Used to reflect abilities                                            
@@ -158,12 +261,52 @@ namespace Langulus::RTTI
       // For functions that can't mutate the context                    
       using ConstantOverloadList = ::std::unordered_map<Signature, FVerbConstant>;
       ConstantOverloadList mOverloadsConstant {};
+
+      // Cost of passing an argument that has to be converted, which    
+      // is always worse than passing it as any of its bases            
+      static constexpr int ConversionCost = 1 << 16;
+      // Overloads can't have more arguments, so that ranking them      
+      // never has to allocate                                          
+      static constexpr Count MaxArguments = 8;
       
    public:
       NOD() bool operator == (const Ability&) const noexcept;
 
       template<CT::Dense, CT::Data VERB, CT::Data...A>
       NOD() static Ability From() noexcept;
+
+      template<bool MUTABLE>
+      NOD() auto Resolve(const DMeta*, Count) const;
+   };
+
+
+   ///                                                                        
+   ///   Overloads of all abilities of a type, frozen after reflection        
+   ///                                                                        
+   /// Only overloads with at most one argument are here, because those are   
+   /// the only ones GetAbility matches exactly - the rest are ranked by      
+   /// Ability::Resolve, and cached in the OverloadCache. They're sorted by   
+   /// the hashes of verb and argument type, so that finding one doesn't      
+   /// allocate, and the mutable and immutable overloads of the same          
+   /// signature share an entry                                               
+   ///                                                                        
+   struct AbilityTable {
+      struct Entry {
+         // Hash of the verb                                            
+         ::std::size_t mVerbHash;
+         // Hash of the argument type, zero for the default overload    
+         ::std::size_t mArgumentHash;
+         VMeta mVerb;
+         // The argument type, or nullptr for the default overload      
+         DMeta mArgument;
+         FVerbMutable mMutable;
+         FVerbConstant mConstant;
+      };
+
+      ::std::vector<Entry> mEntries {};
+
+   public:
+      NOD() const Entry* Find(VMeta, DMeta) const noexcept;
    };
 
 
@@ -189,6 +332,76 @@ namespace Langulus::RTTI
    using ConverterMap = ::std::unordered_map<DMeta, Converter>;
 
 
+   ///                                                                        
+   ///   All direct conversions from a type                                   
+   ///                                                                        
+   /// Conversions are added while other types reflect them, and erased when  
+   /// those types are unloaded, possibly while other threads plan or look    
+   /// up conversions. All maps are guarded by a single mutex, because        
+   /// writes are rare, and reads never exclude each other                    
+   ///                                                                        
+   class ConversionMap {
+      ConverterMap mMap;
+
+      NOD() static ::std::shared_mutex& Mutex() noexcept;
+
+   public:
+      ConversionMap() = default;
+      ConversionMap(const ConversionMap&);
+      ConversionMap& operator = (const ConversionMap&);
+
+      NOD() FCopyConstruct find(DMeta) const noexcept;
+      template<class F>
+      decltype(auto) view(F&&) const;
+      template<class F>
+      decltype(auto) update(F&&);
+   };
+
+
+   ///                                                                        
+   ///   The cheapest chain of conversions between two data types             
+   ///                                                                        
+   /// Each step either calls a reflected converter, or views the previous    
+   /// instance as one of its bases. Intermediate instances are created on    
+   /// the heap, and destroyed as soon as the next step is done with them.    
+   /// Converting a type to itself is a single step, that views the instance  
+   /// as itself, and copies it                                               
+   ///                                                                        
+   struct ConversionPlan {
+      struct Step {
+         // The type this step produces                                 
+         DMeta mType;
+         // The converter, or nullptr if this step views a base         
+         FCopyConstruct mFunction;
+         // Offset of the base, if this step views a base               
+         Offset mOffset;
+      };
+
+      ::std::vector<Step> mSteps {};
+
+   public:
+      NOD() bool IsValid() const noexcept { return not mSteps.empty(); }
+      void Convert(const void*, void*) const;
+   };
+
+
+   ///                                                                        
+   ///   Conversion plans from a type, planned on first use in each epoch     
+   ///   Never copied along with the type, for the same reason member tables  
+   /// aren't, and because copying would race with planning                   
+   ///                                                                        
+   struct ConversionPlans {
+      // Plans, indexed by the origin type they convert to              
+      ::std::unordered_map<const MetaData*, ConversionPlan> mPlans {};
+      // The registry epoch the plans were made in                      
+      Count mEpoch {};
+
+      ConversionPlans() = default;
+      ConversionPlans(const ConversionPlans&) noexcept {}
+      ConversionPlans& operator = (const ConversionPlans&) noexcept { return *this; }
+   };
+
+
    ///                                                                        
    ///   Used to reflect a base for a type                                    
    ///                                                                        
@@ -226,6 +439,49 @@ namespace Langulus::RTTI
 
    using BaseList = ::std::vector<Base>;
 
+   ///                                                                        
+   ///   All bases of a type, including bases of bases, flattened for queries 
+   ///                                                                        
+   struct Ancestry {
+      using DistanceList = ::std::vector<::std::pair<::std::uint32_t, int>>;
+      using IndexList = ::std::vector<::std::uint32_t>;
+
+      // All bases, in the order GetBase enumerates them, with          
+      // accumulated offsets, counts and flags. A base that is          
+      // inherited through multiple paths appears once per path         
+      BaseList mAncestors {};
+      // Minimal number of non-imposed inheritance steps to each        
+      // ancestor, by the ancestor's dense index, sorted by index       
+      DistanceList mDistances {};
+      // Dense indices of all ancestors, sorted and deduplicated        
+      IndexList mIndices {};
+      // Each ancestor's dense index sets bit (index % 64), so that     
+      // most negative HasBase queries end on a single test             
+      ::std::uint64_t mMask {};
+      // The registry epoch the ancestry was built in, or zero if it    
+      // was built before the type and all its ancestors were reflected 
+      Count mEpoch = 0;
+   };
+
+   ///                                                                        
+   ///   Ancestries of a type, built on first use                             
+   ///   Never copied along with the type, because copies are qualified or    
+   /// sparse variants, that always use the ancestry of their origin          
+   ///                                                                        
+   struct Ancestries {
+      // The latest ancestry, or nullptr                                
+      alignas(::std::atomic_ref<const Ancestry*>::required_alignment)
+      const Ancestry* mLatest {};
+      // All ancestries built so far - a replaced one might still be in 
+      // use by another thread, so it is kept until the type is         
+      // destroyed                                                      
+      ::std::vector<::std::unique_ptr<const Ancestry>> mBuilt {};
+
+      Ancestries() = default;
+      Ancestries(const Ancestries&) noexcept {}
+      Ancestries& operator = (const Ancestries&) noexcept { return *this; }
+   };
+
 
    ///                                                                        
    ///   Meta data                                                            
@@ -255,9 +511,10 @@ namespace Langulus::RTTI
       };
       
       static constexpr Token DefaultToken = "NoData";
+      static constexpr ::std::uint32_t NoIndex = ~::std::uint32_t {0};
 
       MetaData(const Token& token)
-         : Meta {token} {
+         : Meta {token, MetaKind::Data} {
          mTokenSanitized = ToLastToken(mToken);
          mTokenSanitized[0] = ::std::toupper(mTokenSanitized[0]);
       }
@@ -269,6 +526,10 @@ namespace Langulus::RTTI
       // The origin type, with all qualifiers and sparseness removed    
       // Will be nullptr for incomplete types                           
       DMeta mOrigin {};
+      // Dense index of the origin type, shared by all its qualified    
+      // and sparse variants. Assigned by token and never reused, so    
+      // the same type has the same index in every boundary             
+      ::std::uint32_t mIndex = NoIndex;
       // The type, when a single pointer is removed                     
       // It is nullptr, if the type isn't sparse                        
       DMeta mDeptr {};
@@ -292,6 +553,11 @@ namespace Langulus::RTTI
       // True if origin type is nullifiable                             
       // Nullifiable data can be batch-constructed via memset(0)        
       bool mIsNullifiable = false;
+      // True if type is trivially relocatable - pointers always are    
+      // Relocatable data can be batch-moved via memmove                
+      // @attention mRelocatorN always works with the origin type, so   
+      // it doesn't relocate pointers, even though this is true for them
+      bool mIsTriviallyRelocatable = false;
       // If origin type is abstract                                     
       bool mIsAbstract = false;
       // True if origin type is marked LANGULUS(DEEP) true              
@@ -301,6 +567,10 @@ namespace Langulus::RTTI
       bool mIsUnallocatable = false;
       // True if origin type is executable (derived from Flow::Verb)    
       bool mIsExecutable = false;
+      // True once reflection of the type has finished                  
+      // Relations aren't cached before that, because they might still  
+      // change while bases and converters are being reflected          
+      bool mIsReflected = false;
       // Size of the reflected type (in bytes)                          
       Size mSize {};
       // Alignof (in bytes)                                             
@@ -329,14 +599,16 @@ namespace Langulus::RTTI
       #endif
 
       // Default constructor wrapped in a lambda upon reflection        
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FDefaultConstruct mDefaultConstructor {};
+      FDefaultConstructN mDefaultConstructorN {};
       // Descriptor constructor wrapped in a lambda upon reflection     
       // @attention this always works with the origin type              
       FDescriptorConstruct mDescriptorConstructor {};
       // Copy constructor wrapped in a lambda upon reflection           
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FCopyConstruct mCopyConstructor {};
+      FCopyConstructN mCopyConstructorN {};
       // Refer constructor wrapped in a lambda upon reflection          
       // @attention this always works with the origin type              
       FCopyConstruct mReferConstructor {};
@@ -347,23 +619,30 @@ namespace Langulus::RTTI
       // @attention this always works with the origin type              
       FCopyConstruct mCloneConstructor {};
       // Move constructor wrapped in a lambda upon reflection           
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FMoveConstruct mMoveConstructor {};
+      FMoveConstructN mMoveConstructorN {};
       // Abandon constructor wrapped in a lambda upon reflection        
       // @attention this always works with the origin type              
       FMoveConstruct mAbandonConstructor {};
+      // Batched relocation, generated upon reflection                  
+      // @attention this always works with the origin type, even in     
+      // pointer variants - relocate those via memmove instead          
+      FRelocateN mRelocatorN {};
 
       // Reference function (if any), wrapped in a lambda on reflection 
       // @attention this always works with the origin type              
       FReference mReference {};
 
       // Destructor wrapped in a lambda upon reflection                 
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FDestroy mDestructor {};
+      FDestroyN mDestructorN {};
 
       // Copy-assignment operator, wrapped in a lambda upon reflection  
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FCopy mCopyAssigner {};
+      FCopyN mCopyAssignerN {};
       // Refer-assignment operator, wrapped in a lambda upon reflection 
       // @attention this always works with the origin type              
       FCopy mReferAssigner {};
@@ -374,23 +653,26 @@ namespace Langulus::RTTI
       // @attention this always works with the origin type              
       FCopy mCloneAssigner {};
       // Move-assignment, wrapped in a lambda upon reflection           
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FMove mMoveAssigner {};
+      FMoveN mMoveAssignerN {};
       // Abandon-assignment, wrapped in a lambda upon reflection        
       // @attention this always works with the origin type              
       FMove mAbandonAssigner {};
 
       // The == operator, wrapped in a lambda upon reflection           
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FCompare mComparer {};
+      FCompareN mComparerN {};
 
       // The ClassBlock method, wrapped in a lambda upon reflection     
       // @attention this always works with the origin type              
       FResolve mResolver {};
 
       // The GetHash() method, wrapped in a lambda                      
-      // @attention this always works with the origin type              
+      // @attention both of these always work with the origin type      
       FHash mHasher {};
+      FHashN mHasherN {};
 
       // The Do verb, wrapped in a lambda (mutable context)             
       // @attention this always works with the origin type              
@@ -401,13 +683,29 @@ namespace Langulus::RTTI
       
       // List of reflected members of the origin type                   
       MemberList mMembers {};
+      // Members of the origin type and all its bases, built on first   
+      // use, because member types might not be reflected before that,  
+      // and rebuilt after a boundary is unloaded, because member types 
+      // might have been unloaded with it                               
+      mutable MemberTables mMemberTables {};
       // List of reflected abilities of the origin type                 
       AbilityList mAbilities {};
+      // The abilities above, frozen for dispatching                    
+      AbilityTable mAbilityTable {};
       // List of reflected bases of the origin type                     
       BaseList mBases {};
+      // All bases of the origin type, including bases of bases, built  
+      // on first use, because bases might still be reflecting when     
+      // they're set, and rebuilt after a boundary is unloaded          
+      mutable Ancestries mAncestries {};
       // List of reflected converters to/from the origin type           
       ConverterMap mConvertersTo {};
       ConverterMap mConvertersFrom {};
+      // All direct conversions from the origin type, whether they're   
+      // reflected in it, or in the type it converts to                 
+      ConversionMap mConversions {};
+      // Conversion plans from the origin type, planned on first use    
+      mutable ConversionPlans mConversionPlans {};
       // List of named values of the origin type                        
       NamedValueList mNamedValues {};
 
@@ -420,19 +718,28 @@ namespace Langulus::RTTI
       template<CT::Decayed>
       static void ReflectOriginType(MetaData&) noexcept;
 
-      NOD() const Member* GetMemberInner(TMeta, DMeta, Offset&) const noexcept;
-      NOD() Count GetMemberCountInner(TMeta, DMeta, Offset&) const noexcept;
+      template<class F>
+      void ForEachMember(TMeta, DMeta, F&&) const noexcept;
+
+      template<bool BINARY_COMPATIBLE, bool ADVANCED>
+      NOD() bool CastsToInner(DMeta) const;
+      NOD() bool IsRelatedToInner(DMeta) const;
+      NOD() Distance GetDistanceToInner(DMeta) const;
+      NOD() static ::std::uint32_t IndexOf(const Token&);
 
       template<class, CT::Dense...Args>
       void SetBases(Types<Args...>) noexcept;
 
       template<CT::Dense, CT::Dense...Args>
       void SetAbilities(Types<Args...>) noexcept;
+      void FreezeAbilities();
 
       template<class, class...Args>
       void SetConvertersTo(Types<Args...>) noexcept;
       template<class, class...Args>
       void SetConvertersFrom(Types<Args...>) noexcept;
+      static void AddConversion(MetaData&, const Converter&, bool) noexcept;
+      NOD() ConversionPlan PlanConversion(const MetaData*) const;
 
       template<class>
       void AddConstant(auto&&);
@@ -465,6 +772,7 @@ namespace Langulus::RTTI
       //                                                                
       // Base management                                                
       //                                                                
+      NOD() const Ancestry& GetAncestry() const;
       NOD() bool GetBase(DMeta, Offset, Base&) const;
       template<CT::Data>
       NOD() bool GetBase(Offset, Base&) const;
@@ -480,6 +788,7 @@ namespace Langulus::RTTI
       //                                                                
       // Member management                                              
       //                                                                
+      NOD() const MemberTable& GetMemberTable() const;
       NOD() const Member* GetMember(TMeta, DMeta = {}, Offset = 0) const noexcept;
       NOD() Count GetMemberCount(TMeta, DMeta = {}, Offset = 0) const noexcept;
       NOD() Count GetMemberCount() const noexcept;
@@ -497,6 +806,8 @@ namespace Langulus::RTTI
       NOD() auto GetAbility(DMeta) const;
       template<bool MUTABLE, CT::Data V, CT::Data...A>
       NOD() auto GetAbility() const;
+      template<bool MUTABLE>
+      NOD() auto ResolveAbility(VMeta, const DMeta*, Count) const;
 
       //                                                                
       // Named value management                                         
@@ -506,7 +817,8 @@ namespace Langulus::RTTI
       //                                                                
       // Morphisms and comparison                                       
       //                                                                
-      FCopyConstruct GetConverter(DMeta) const;
+      NOD() FCopyConstruct GetConverter(DMeta) const noexcept;
+      NOD() const ConversionPlan& GetConversionPlan(DMeta) const;
 
       template<bool BINARY_COMPATIBLE = false, bool ADVANCED = false>
       NOD() bool CastsTo(DMeta) const;
@@ -525,6 +837,7 @@ namespace Langulus::RTTI
       template<class>
       NOD() Distance GetDistanceTo() const;
       NOD() Distance GetDistanceTo(DMeta) const;
+      void GetDistancesTo(const DMeta*, Count, Distance*) const;
 
       template<class, class...>
       NOD() constexpr bool Is() const;
@@ -539,4 +852,199 @@ namespace Langulus::RTTI
       NOD() constexpr bool IsExact(DMeta) const noexcept;
    };
 
+
+   ///                                                                        
+   ///   Hit and miss counters of a per-thread cache                          
+   ///                                                                        
+   /// Each thread counts in its own record, so counting never contends with  
+   /// other threads. Records are summed only when totals are requested, and  
+   /// are reused by other threads, when their owner exits                    
+   ///   @tparam CACHE - the cache the counters belong to                     
+   ///                                                                        
+   template<class CACHE>
+   class CacheCounters {
+      // Counters of a single thread, written only by their owner       
+      // Records are never deallocated, but are reused by other threads 
+      struct alignas(64) Record {
+         ::std::atomic<Count> mHits = 0;
+         ::std::atomic<Count> mMisses = 0;
+         // Whether a thread currently owns the record                  
+         ::std::atomic<bool> mOwned = true;
+         // Next record in the list                                     
+         Record* mNext = nullptr;
+      };
+
+      // Releases the record of a thread, when the thread exits         
+      struct Owner {
+         Record* mRecord;
+
+         ~Owner() {
+            mRecord->mOwned.store(false, ::std::memory_order_release);
+         }
+      };
+
+      // Lock-free list of all records, only ever pushed to             
+      static inline ::std::atomic<Record*> Records = nullptr;
+
+      /// Get the record of the current thread, acquiring one on first use    
+      ///   @return the record                                                
+      static Record& Local() {
+         static thread_local Owner owner {Acquire()};
+         return *owner.mRecord;
+      }
+
+      /// Reuse the record of an exited thread, or push a new one             
+      ///   @return the acquired record                                       
+      static Record* Acquire() {
+         auto record = Records.load(::std::memory_order_acquire);
+         while (record) {
+            bool expected = false;
+            if (record->mOwned.compare_exchange_strong(expected, true))
+               return record;
+            record = record->mNext;
+         }
+
+         record = new Record;
+         record->mNext = Records.load(::std::memory_order_relaxed);
+         while (not Records.compare_exchange_weak(record->mNext, record,
+            ::std::memory_order_release, ::std::memory_order_relaxed));
+         return record;
+      }
+
+      /// Increment a counter of the current thread                           
+      /// Only the owner ever writes it, so no read-modify-write is needed    
+      ///   @param counter - the counter to increment                         
+      static void Increment(::std::atomic<Count>& counter) noexcept {
+         counter.store(
+            counter.load(::std::memory_order_relaxed) + 1,
+            ::std::memory_order_relaxed
+         );
+      }
+
+      /// Sum a counter of all threads                                        
+      ///   @param counter - the counter to sum                               
+      ///   @return the sum                                                   
+      static Count Sum(::std::atomic<Count> Record::*counter) noexcept {
+         Count sum = 0;
+         auto record = Records.load(::std::memory_order_acquire);
+         while (record) {
+            sum += (record->*counter).load(::std::memory_order_relaxed);
+            record = record->mNext;
+         }
+         return sum;
+      }
+
+   public:
+      /// Count a query answered from cache, in the current thread            
+      static void Hit() { Increment(Local().mHits); }
+
+      /// Count a query that had to be computed, in the current thread        
+      static void Miss() { Increment(Local().mMisses); }
+
+      /// Get the number of queries answered from cache, in all threads       
+      NOD() static Count GetHits() noexcept {
+         return Sum(&Record::mHits);
+      }
+
+      /// Get the number of queries that had to be computed, in all threads   
+      NOD() static Count GetMisses() noexcept {
+         return Sum(&Record::mMisses);
+      }
+   };
+
+
+   ///                                                                        
+   ///   Cache of relations between pairs of data types                       
+   ///                                                                        
+   /// Remembers the results of CastsTo, IsRelatedTo and GetDistanceTo for    
+   /// the most recently queried pairs of definitions. Each thread has its    
+   /// own bounded, direct-mapped table, so lookups never synchronize. All    
+   /// entries are stamped with the registry epoch, so unloading a boundary   
+   /// invalidates them, before any unloaded definition can be matched.       
+   /// Relations of definitions that are still being reflected are never      
+   /// remembered, because they might change once reflection finishes         
+   ///                                                                        
+   struct RelationCache {
+      /// The relation queries that are cached                                
+      enum Query : ::std::uint8_t {
+         CastsTo = 0,
+         CastsToBinary,
+         CastsToAdvanced,
+         CastsToBinaryAdvanced,
+         RelatedTo,
+         DistanceTo
+      };
+
+      /// Number of entries in the table of each thread                       
+      static constexpr Count Size = 1024;
+
+      template<class F>
+      NOD() static int Get(const MetaData*, const MetaData*, Query, F&&);
+
+      /// Get the number of queries answered from cache, in all threads       
+      NOD() static Count GetHits() noexcept {
+         return Counters::GetHits();
+      }
+
+      /// Get the number of queries that had to be computed, in all threads   
+      NOD() static Count GetMisses() noexcept {
+         return Counters::GetMisses();
+      }
+
+   private:
+      using Counters = CacheCounters<RelationCache>;
+
+      struct Entry {
+         const MetaData* mFrom;
+         const MetaData* mTo;
+         // Zero marks an empty entry, since epochs start at one        
+         Count mEpoch;
+         int mResult;
+         Query mQuery;
+      };
+   };
+
+
+   ///                                                                        
+   ///   Cache of resolved overloads                                          
+   ///                                                                        
+   /// Remembers which overload was picked for the most recently dispatched   
+   /// signatures, so that arguments that aren't an exact match are ranked    
+   /// only once. Like the RelationCache, it is bounded, direct-mapped and    
+   /// per-thread, and its entries are stamped with the registry epoch        
+   ///                                                                        
+   struct OverloadCache {
+      /// Number of entries in the table of each thread                       
+      static constexpr Count Size = 256;
+      /// Signatures with more arguments are never cached                     
+      static constexpr Count MaxArguments = 4;
+
+      template<bool MUTABLE, class F>
+      NOD() static auto Get(const MetaData*, VMeta, const DMeta*, Count, F&&);
+
+      /// Get the number of resolutions answered from cache, in all threads   
+      NOD() static Count GetHits() noexcept {
+         return Counters::GetHits();
+      }
+
+      /// Get the number of resolutions that had to be ranked, in all threads 
+      NOD() static Count GetMisses() noexcept {
+         return Counters::GetMisses();
+      }
+
+   private:
+      using Counters = CacheCounters<OverloadCache>;
+
+      template<bool MUTABLE>
+      struct Entry {
+         const MetaData* mType;
+         const MetaVerb* mVerb;
+         const MetaData* mArguments[MaxArguments];
+         Count mCount;
+         // Zero marks an empty entry, since epochs start at one        
+         Count mEpoch;
+         Conditional<MUTABLE, FVerbMutable, FVerbConstant> mFunction;
+      };
+   };
+
 } // namespace Langulus::RTTI
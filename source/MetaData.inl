@@ -11,13 +11,17 @@
 #include "Fundamental.hpp"
 #include "MetaData.hpp"
 #include "MetaConst.hpp"
+#include <mutex>
+#include <shared_mutex>
 #if LANGULUS_FEATURE(MANAGED_REFLECTION)
    #include "RTTI.hpp"
 #else
+   #include "TokenMap.hpp"
    #include <memory>
 #endif
 #include <Core/Utilities.hpp>
 #include <tuple>
+#include <optional>
 
 #if 0
    #define VERBOSE(...)      Logger::Verbose(__VA_ARGS__)
@@ -69,6 +73,22 @@ namespace Langulus::RTTI
          return &(context->*HANDLE::Handle);
       };
 
+      // The handle always points to a member declared in THIS, so      
+      // its offset is the same in all instances, and can be computed   
+      // once, the same way base offsets are                            
+      // @attention works only with conventional layouts                
+      alignas(THIS) static const Byte storage[sizeof(THIS)];
+      const auto owner = reinterpret_cast<const THIS*>(storage);
+      const auto offset =
+         reinterpret_cast<const Byte*>(&(owner->*HANDLE::Handle)) -
+         reinterpret_cast<const Byte*>(owner);
+
+      // Anything outside the owner is an odd layout, so fall back to   
+      // the retriever for it                                           
+      if (offset >= 0
+      and static_cast<Offset>(offset) + sizeof(DATA) <= sizeof(THIS))
+         mOffset = static_cast<Offset>(offset);
+
       mCount = ExtentOf<DATA>;
 
       if constexpr (requires { DATA::CTTI_TagTag; }) {
@@ -86,20 +106,66 @@ namespace Langulus::RTTI
    /// TMeta is returned: while(member->GetTrait(i++))                        
    template<class...T>
    TMeta Member::TraitSelector(int index, Types<T...>&&) {
-      if (index < static_cast<int>(sizeof...(T))) {
-         const TMeta tags[] {MetaTrait::Of<T>()...};
-         return tags[index];
+      // Only the requested tag is retrieved                            
+      TMeta result;
+      int i = 0;
+      (void) ((i++ == index and (result = MetaTrait::Of<T>(), true)) or ...);
+      return result;
+   }
+
+   /// Get the type and first trait tag of the member, running retrievers     
+   /// only if they weren't run since the last time a boundary was unloaded   
+   ///   @param type - [out] the resolved type                                
+   ///   @param trait - [out] the resolved first trait tag, if any            
+   inline void Member::Resolve(DMeta& type, TMeta& trait) const {
+      LANGULUS_ASSUME(DevAssumes, mTypeRetriever,
+         "Invalid member type retriever");
+
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
+
+      using EpochRef = ::std::atomic_ref<Count>;
+      using MetaRef = ::std::atomic_ref<const Meta*>;
+
+      // Read optimistically, and make sure nothing was written in the  
+      // meantime by reading the epoch once again                       
+      if (EpochRef {mResolvedEpoch}.load(::std::memory_order_acquire) == epoch) {
+         const auto resolvedType = MetaRef {mResolvedType}.load(::std::memory_order_relaxed);
+         const auto resolvedTrait = MetaRef {mResolvedTrait}.load(::std::memory_order_relaxed);
+         ::std::atomic_thread_fence(::std::memory_order_acquire);
+         if (EpochRef {mResolvedEpoch}.load(::std::memory_order_relaxed) == epoch) {
+            type = static_cast<const MetaData*>(resolvedType);
+            trait = static_cast<const MetaTrait*>(resolvedTrait);
+            return;
+         }
       }
-      else return {};
+
+      type = mTypeRetriever();
+      trait = mTraitRetriever ? mTraitRetriever(0) : TMeta {};
+
+      // Writers are serialized, and invalidate the epoch while they    
+      // write, so that readers never see a mix of two resolutions      
+      static ::std::mutex mutex;
+      const ::std::lock_guard lock {mutex};
+      EpochRef {mResolvedEpoch}.store(0, ::std::memory_order_relaxed);
+      ::std::atomic_thread_fence(::std::memory_order_release);
+      MetaRef {mResolvedType}.store(type.operator -> (), ::std::memory_order_relaxed);
+      MetaRef {mResolvedTrait}.store(trait.operator -> (), ::std::memory_order_relaxed);
+      EpochRef {mResolvedEpoch}.store(epoch, ::std::memory_order_release);
    }
 
    /// Get the reflected member type at runtime                               
    ///   @return return the type                                              
    LANGULUS(INLINED)
    DMeta Member::GetType() const {
-      LANGULUS_ASSUME(DevAssumes, mTypeRetriever,
-         "Invalid member type retriever");
-      return mTypeRetriever();
+      DMeta type;
+      TMeta trait;
+      Resolve(type, trait);
+      return type;
    }
 
    /// Get the reflected member trait at runtime                              
@@ -107,14 +173,22 @@ namespace Langulus::RTTI
    ///   @return return the trait, if any, or nullptr otherwise               
    LANGULUS(INLINED)
    TMeta Member::GetTrait(int index) const {
-      return mTraitRetriever ? mTraitRetriever(index) : TMeta {};
+      if (not mTraitRetriever)
+         return {};
+      if (index != 0)
+         return mTraitRetriever(index);
+
+      DMeta type;
+      TMeta trait;
+      Resolve(type, trait);
+      return trait;
    }
    
    /// Compare members                                                        
    ///   @param rhs - the member to compare against                           
    ///   @return true if members match                                        
    LANGULUS(INLINED)
-   bool Member::operator == (const Member& rhs) const noexcept {
+   bool Member::operator == (const Member& rhs) const {
       // Compare type and size/offset first                             
       if (GetType() != rhs.GetType() or mCount != rhs.mCount)
          return false;
@@ -151,6 +225,8 @@ namespace Langulus::RTTI
    ///   @return a raw constant pointer to the member inside the instance     
    LANGULUS(INLINED)
    const Byte* Member::Get(const Byte* instance) const noexcept {
+      if (mOffset != NoOffset)
+         return instance + mOffset;
       return reinterpret_cast<Byte*>(
          mValueRetriever(const_cast<Byte*>(instance)));
    }
@@ -160,9 +236,23 @@ namespace Langulus::RTTI
    ///   @return a raw pointer to the member inside the instance              
    LANGULUS(INLINED)
    Byte* Member::Get(Byte* instance) const noexcept {
+      if (mOffset != NoOffset)
+         return instance + mOffset;
       return reinterpret_cast<Byte*>(mValueRetriever(instance));
    }
 
+   /// Check if a resolved member is tagged with a trait                      
+   ///   @param trait - the trait to search for                               
+   ///   @return true if the member has the trait                             
+   LANGULUS(INLINED)
+   bool ResolvedMember::HasTrait(TMeta trait) const noexcept {
+      for (auto& tag : mTraits) {
+         if (tag == trait)
+            return true;
+      }
+      return false;
+   }
+
 
    ///                                                                        
    ///   Ability implementation                                               
@@ -182,6 +272,8 @@ namespace Langulus::RTTI
    Ability Ability::From() noexcept {
       static_assert(CT::DerivedFrom<VERB, Flow::Verb>,
          "VERB must inherit Flow::Verb");
+      static_assert(sizeof...(A) <= MaxArguments,
+         "Too many arguments for an overload");
 
       Ability result;
       result.mVerb = MetaVerb::Of<VERB>();
@@ -217,6 +309,114 @@ namespace Langulus::RTTI
       return result;
    }
 
+   /// Pick the overload that accepts a list of argument types best           
+   /// Each argument costs its distance to the type of the parameter, or      
+   /// ConversionCost if it can only be converted to it. Candidates are       
+   /// ranked by total cost, and then by the costs of the arguments, in       
+   /// order. If nothing fits, or the best candidates tie, the default        
+   /// overload is picked, just like in GetAbility                            
+   ///   @tparam MUTABLE - whether to pick mutable/immutable overload         
+   ///   @param arguments - the types of the arguments                        
+   ///   @param count - the number of arguments                               
+   ///   @return the best overload, or nullptr if none fits                   
+   template<bool MUTABLE>
+   auto Ability::Resolve(const DMeta* arguments, Count count) const {
+      using F = Conditional<MUTABLE, FVerbMutable, FVerbConstant>;
+      const auto& overloads = [this]() -> auto& {
+         if constexpr (MUTABLE)
+            return mOverloadsMutable;
+         else
+            return mOverloadsConstant;
+      }();
+
+      F best {};
+      bool found = false;
+      bool ambiguous = false;
+      ::std::int64_t bestTotal = 0;
+      int bestCosts[MaxArguments];
+      int costs[MaxArguments];
+
+      // No overload has more than MaxArguments arguments               
+      if (count > MaxArguments)
+         count = 0;
+
+      for (auto& [signature, function] : overloads) {
+         if (count == 0 or signature.size() != count)
+            continue;
+
+         // Rank each argument, rejecting the candidate on first miss   
+         Offset ranked = 0;
+         ::std::int64_t total = 0;
+         for (; ranked < count; ++ranked) {
+            const auto argument = arguments[ranked];
+            if (not argument)
+               break;
+
+            const auto distance = argument->GetDistanceTo(signature[ranked]);
+            if (distance != MetaData::Distance::Infinite)
+               costs[ranked] = distance;
+            else if (argument->GetConverter(signature[ranked]))
+               costs[ranked] = ConversionCost;
+            else
+               break;
+            total += costs[ranked];
+         }
+
+         if (ranked != count)
+            continue;
+
+         if (found) {
+            const auto worse = ::std::lexicographical_compare(
+               bestCosts, bestCosts + count, costs, costs + count);
+            if (total > bestTotal or (total == bestTotal and worse))
+               continue;
+            if (total == bestTotal and ::std::equal(costs, costs + count, bestCosts)) {
+               ambiguous = true;
+               continue;
+            }
+         }
+
+         best = function;
+         found = true;
+         bestTotal = total;
+         ::std::copy_n(costs, count, bestCosts);
+         ambiguous = false;
+      }
+
+      if (best and not ambiguous)
+         return best;
+
+      // Always fallback to default function, if reflected              
+      const auto fallback = overloads.find({});
+      return fallback != overloads.end() ? fallback->second : F {};
+   }
+
+   /// Find the entry of an exact signature                                   
+   ///   @param verb - the verb                                               
+   ///   @param argument - the argument type, or nullptr for default overload 
+   ///   @return the entry, or nullptr if no such overload was reflected      
+   inline auto AbilityTable::Find(VMeta verb, DMeta argument) const noexcept
+   -> const Entry* {
+      if (not verb)
+         return nullptr;
+
+      const auto verbHash = verb->mHash.mHash;
+      const auto argumentHash = argument ? argument->mHash.mHash : 0;
+      auto it = ::std::lower_bound(mEntries.begin(), mEntries.end(), 0,
+         [&](const Entry& entry, int) {
+            return entry.mVerbHash < verbHash or (entry.mVerbHash == verbHash
+               and entry.mArgumentHash < argumentHash);
+         });
+
+      // Hashes might collide, so make sure it's the same signature     
+      for (; it != mEntries.end() and it->mVerbHash == verbHash
+             and it->mArgumentHash == argumentHash; ++it) {
+         if (it->mVerb == verb and it->mArgument == argument)
+            return &*it;
+      }
+      return nullptr;
+   }
+
 
    ///                                                                        
    ///   Converter implementation                                             
@@ -262,6 +462,134 @@ namespace Langulus::RTTI
    }
 
 
+   ///                                                                        
+   ///   ConversionMap implementation                                         
+   ///                                                                        
+
+   /// Get the mutex, that guards the conversions of all types                
+   ///   @return the mutex                                                    
+   LANGULUS(INLINED)
+   ::std::shared_mutex& ConversionMap::Mutex() noexcept {
+      static ::std::shared_mutex mutex;
+      return mutex;
+   }
+
+   /// Copy the conversions of another type                                   
+   ///   @param other - the conversions to copy                               
+   LANGULUS(INLINED)
+   ConversionMap::ConversionMap(const ConversionMap& other) {
+      const ::std::shared_lock lock {Mutex()};
+      mMap = other.mMap;
+   }
+
+   /// Copy the conversions of another type                                   
+   ///   @attention assumes this map isn't yet visible to other threads       
+   ///   @param other - the conversions to copy                               
+   ///   @return a reference to this map                                      
+   LANGULUS(INLINED)
+   ConversionMap& ConversionMap::operator = (const ConversionMap& other) {
+      if (this != &other) {
+         const ::std::shared_lock lock {Mutex()};
+         mMap = other.mMap;
+      }
+      return *this;
+   }
+
+   /// Find a direct conversion                                               
+   ///   @param type - the type to convert to                                 
+   ///   @return the conversion function, or nullptr if none was reflected    
+   LANGULUS(INLINED)
+   FCopyConstruct ConversionMap::find(DMeta type) const noexcept {
+      const ::std::shared_lock lock {Mutex()};
+      const auto found = mMap.find(type);
+      return found != mMap.end() ? found->second.mFunction : nullptr;
+   }
+
+   /// Inspect all conversions, while no type can add or erase any            
+   ///   @attention don't reflect or unload anything inside the call          
+   ///   @param call - the function that inspects the map                     
+   ///   @return whatever the function returns                                
+   template<class F>
+   decltype(auto) ConversionMap::view(F&& call) const {
+      const ::std::shared_lock lock {Mutex()};
+      return call(static_cast<const ConverterMap&>(mMap));
+   }
+
+   /// Modify the conversions, while nothing else can inspect them            
+   ///   @attention don't reflect or unload anything inside the call          
+   ///   @param call - the function that modifies the map                     
+   ///   @return whatever the function returns                                
+   template<class F>
+   decltype(auto) ConversionMap::update(F&& call) {
+      const ::std::unique_lock lock {Mutex()};
+      return call(mMap);
+   }
+
+
+   ///                                                                        
+   ///   ConversionPlan implementation                                        
+   ///                                                                        
+
+   /// Convert an instance by executing all steps of the plan                 
+   ///   @attention assumes the plan is valid                                 
+   ///   @attention assumes destination memory is not initialized             
+   ///   @param from - the instance to convert                                
+   ///   @param to - the uninitialized instance to convert to                 
+   inline void ConversionPlan::Convert(const void* from, void* to) const {
+      LANGULUS_ASSUME(DevAssumes, IsValid(), "Invalid conversion plan");
+
+      // Owns the intermediate instance, in case a step throws          
+      struct Temporary {
+         DMeta mType;
+         void* mInstance;
+         bool mConstructed = false;
+
+         Temporary(DMeta type)
+            : mType {type}
+            , mInstance {::operator new(type->mSize.mSize,
+               ::std::align_val_t {type->mAlignment.mSize})} {}
+
+         Temporary(const Temporary&) = delete;
+
+         ~Temporary() {
+            if (mConstructed and mType->mDestructor)
+               mType->mDestructor(mInstance);
+            ::operator delete(mInstance,
+               ::std::align_val_t {mType->mAlignment.mSize});
+         }
+      };
+
+      // Each intermediate instance is needed only until the next one   
+      // is converted from it (or from its base), so two alternating    
+      // buffers are enough                                             
+      auto source = static_cast<const Byte*>(from);
+      ::std::optional<Temporary> buffers[2];
+      Offset current = 0;
+      for (Offset i = 0; i < mSteps.size(); ++i) {
+         const auto& step = mSteps[i];
+         const bool last = i + 1 == mSteps.size();
+         if (not step.mFunction) {
+            // Just view the base, and copy it if it's the result       
+            source += step.mOffset;
+            if (last)
+               step.mType->mCopyConstructor(source, to);
+            continue;
+         }
+
+         if (last) {
+            step.mFunction(source, to);
+            break;
+         }
+
+         current ^= 1;
+         auto& next = buffers[current].emplace(step.mType);
+         step.mFunction(source, next.mInstance);
+         next.mConstructed = true;
+         source = static_cast<const Byte*>(next.mInstance);
+      }
+   }
+
+
    ///                                                                        
    ///   Base implementation                                                  
    ///                                                                        
@@ -383,18 +711,28 @@ namespace Langulus::RTTI
       static_assert(token != "", "Invalid data token is not allowed");
 
       #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         // Each thread keeps a cached pointer to the definition, but   
+         // it is valid only for the registry epoch it was retrieved    
+         // in, because the library that defined it might be reloaded,  
+         // and thus produce new pointer.                               
+         static thread_local RTTI::MetaCache<DMeta> cache;
+         const auto epoch = Instance.GetEpoch();
+         if (cache.mEpoch == epoch)
+            return cache.mMeta;
+
          // Try to get the definition, type might have been reflected   
-         // previously in another library. Unfortunately we can't keep  
-         // a static pointer to the meta, because forementioned library 
-         // might be reloaded, and thus produce new pointer.            
+         // previously in another library                               
          DMeta meta = Instance.GetMetaData(token, RTTI::Boundary);
-         if (meta)
+         if (meta) {
+            cache = {meta, epoch};
             return meta;
+         }
 
          // If this is reached, then type is not defined yet            
          // We immediately request its spot in the database, or the     
          // reflection function might end up forever looping otherwise  
          meta = Instance.RegisterData(token, RTTI::Boundary);
+         cache = {meta, epoch};
          auto& generated = const_cast<MetaData&>(*meta);
       #else
          // Keep a static meta pointer for each translation unit        
@@ -414,6 +752,7 @@ namespace Langulus::RTTI
          auto denser = MetaData::Of<Deptr<T>>();
          generated = *denser;
          generated.mDeptr = denser;
+         generated.mIsReflected = false;
 
          #if LANGULUS_FEATURE(MANAGED_MEMORY)
             generated.mPool = nullptr;
@@ -453,6 +792,7 @@ namespace Langulus::RTTI
       generated.mAlignment = alignof(T);
       generated.mIsSparse = true;
       generated.mIsConstant = CT::Constant<T>;
+      generated.mIsTriviallyRelocatable = true;
       
       // Calculate the allocation page and table                        
       // It is the same for all kinds of pointers                       
@@ -464,6 +804,7 @@ namespace Langulus::RTTI
          generated.mAllocationTable[bit] = ::std::max(minElements, elements);
       }
 
+      generated.mIsReflected = true;
       VERBOSE("Data ", Logger::PushCyan, generated.mToken,
          Logger::PopGreen, " registered (", generated.mLibraryName, ")");
       return &generated;
@@ -497,18 +838,28 @@ namespace Langulus::RTTI
          "you have probably equipped your type with an empty LANGULUS(NAME)");
 
       #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         // Each thread keeps a cached pointer to the definition, but   
+         // it is valid only for the registry epoch it was retrieved    
+         // in, because the library that defined it might be reloaded,  
+         // and thus produce new pointer.                               
+         static thread_local RTTI::MetaCache<DMeta> cache;
+         const auto epoch = Instance.GetEpoch();
+         if (cache.mEpoch == epoch)
+            return cache.mMeta;
+
          // Try to get the definition, type might have been reflected   
-         // previously in another library. Unfortunately we can't keep  
-         // a static pointer to the meta, because forementioned library 
-         // might be reloaded, and thus produce new pointer.            
+         // previously in another library                               
          DMeta meta = Instance.GetMetaData(token, RTTI::Boundary);
-         if (meta)
+         if (meta) {
+            cache = {meta, epoch};
             return meta;
+         }
 
          // If this is reached, then type is not defined yet            
          // We immediately request its spot in the database, or the     
          // reflection function might end up forever looping otherwise  
          meta = Instance.RegisterData(token, RTTI::Boundary);
+         cache = {meta, epoch};
          auto& generated = const_cast<MetaData&>(*meta);
       #else
          // Keep a static meta pointer for each translation unit        
@@ -527,6 +878,7 @@ namespace Langulus::RTTI
       auto denser = MetaData::Of<Decay<T>>();
       generated = *denser;
       generated.mOrigin = denser;
+      generated.mIsReflected = false;
       generated.mDecvq = MetaData::Of<DecvqAll<T>>();
 
       // Set library boundary - non-origin types are always associated  
@@ -561,6 +913,7 @@ namespace Langulus::RTTI
 
       generated.mCppName = CppNameOf<T>();
       generated.mIsConstant = CT::Constant<T>;
+      generated.mIsReflected = true;
 
       VERBOSE("Data ", Logger::PushCyan, generated.mToken,
          Logger::PopGreen, " registered (", generated.mLibraryName, ")");
@@ -606,18 +959,28 @@ namespace Langulus::RTTI
          "you have probably equipped your type with an empty LANGULUS(NAME)");
 
       #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         // Each thread keeps a cached pointer to the definition, but   
+         // it is valid only for the registry epoch it was retrieved    
+         // in, because the library that defined it might be reloaded,  
+         // and thus produce new pointer.                               
+         static thread_local RTTI::MetaCache<DMeta> cache;
+         const auto epoch = Instance.GetEpoch();
+         if (cache.mEpoch == epoch)
+            return cache.mMeta;
+
          // Try to get the definition, type might have been reflected   
-         // previously in another library. Unfortunately we can't keep  
-         // a static pointer to the meta, because forementioned library 
-         // might be reloaded, and thus produce new pointer.            
+         // previously in another library                               
          DMeta meta = Instance.GetMetaData(token, RTTI::Boundary);
-         if (meta)
+         if (meta) {
+            cache = {meta, epoch};
             return meta;
+         }
 
          // If this is reached, then type is not defined yet            
          // We immediately request its spot in the database, or the     
          // reflection function might end up forever looping otherwise  
          meta = Instance.RegisterData(token, RTTI::Boundary);
+         cache = {meta, epoch};
          MetaData& generated = const_cast<MetaData&>(*meta);
       #else
          // Keep a static meta pointer for each translation unit        
@@ -643,6 +1006,7 @@ namespace Langulus::RTTI
       generated.mCppName = CppNameOf<T>();
       generated.mIsAbstract = CT::Abstract<T>;
       generated.mIsNullifiable = CT::Nullifiable<T>;
+      generated.mIsTriviallyRelocatable = CT::Relocatable<T>;
       generated.mSize = sizeof(T);
       generated.mAlignment = alignof(T);
       generated.mIsPOD = CT::POD<T>;
@@ -652,6 +1016,7 @@ namespace Langulus::RTTI
 
       // This is the origin type, so self-refer                         
       generated.mOrigin = &generated;
+      generated.mIndex = IndexOf(token);
       generated.mDecvq = &generated;
 
       // Calculate the allocation page and table                        
@@ -712,6 +1077,7 @@ namespace Langulus::RTTI
          generated.mVersionMinor = T::CTTI_VersionMinor;
 
       ReflectOriginType<T>(generated);
+      generated.mIsReflected = true;
 
       VERBOSE("Data ", Logger::PushCyan, generated.mToken,
          Logger::PopGreen, " registered (", generated.mLibraryName, ")");
@@ -799,6 +1165,23 @@ namespace Langulus::RTTI
                ::std::memset(at, 0, sizeof(T));
             };
       }
+
+      // Batch default construction prefers nullifying, if possible     
+      if constexpr (CT::Nullifiable<T>) {
+         generated.mDefaultConstructorN =
+            [](void* at, Count count) noexcept {
+               ::std::memset(at, 0, sizeof(T) * count);
+            };
+      }
+      else if constexpr (CT::Defaultable<T>) {
+         constexpr bool NoExcept = CT::DefaultableNoexcept<T>;
+         generated.mDefaultConstructorN =
+            [](void* at, Count count) noexcept(NoExcept) {
+               auto atT = static_cast<T*>(at);
+               for (Count i = 0; i < count; ++i)
+                  new (atT + i) T {};
+            };
+      }
          
       // Wrap the descriptor constructor of the type inside lambda      
       if constexpr (CT::DescriptorMakable<T>) {
@@ -818,6 +1201,22 @@ namespace Langulus::RTTI
                auto toT = static_cast<T*>(to);
                IntentNew(toT, Copy(*fromT));
             };
+
+         if constexpr (CT::POD<T>) {
+            generated.mCopyConstructorN =
+               [](const void* from, void* to, Count count) noexcept {
+                  ::std::memcpy(to, from, sizeof(T) * count);
+               };
+         }
+         else {
+            generated.mCopyConstructorN =
+               [](const void* from, void* to, Count count) {
+                  auto fromT = static_cast<const T*>(from);
+                  auto toT = static_cast<T*>(to);
+                  for (Count i = 0; i < count; ++i)
+                     IntentNew(toT + i, Copy(fromT[i]));
+               };
+         }
       }
             
       // Wrap the refer constructor of the type inside lambda           
@@ -858,6 +1257,22 @@ namespace Langulus::RTTI
                auto toT = static_cast<T*>(to);
                IntentNew(toT, Move(*fromT));
             };
+
+         if constexpr (CT::POD<T>) {
+            generated.mMoveConstructorN =
+               [](void* from, void* to, Count count) noexcept {
+                  ::std::memcpy(to, from, sizeof(T) * count);
+               };
+         }
+         else {
+            generated.mMoveConstructorN =
+               [](void* from, void* to, Count count) {
+                  auto fromT = static_cast<T*>(from);
+                  auto toT = static_cast<T*>(to);
+                  for (Count i = 0; i < count; ++i)
+                     IntentNew(toT + i, Move(fromT[i]));
+               };
+         }
       }
 
       // Wrap the abandon constructor of the type inside a lambda       
@@ -886,6 +1301,48 @@ namespace Langulus::RTTI
                auto atT = static_cast<T*>(at);
                atT->~T();
             };
+
+         if constexpr (::std::is_trivially_destructible_v<T>) {
+            generated.mDestructorN =
+               [](void*, Count) noexcept {};
+         }
+         else {
+            generated.mDestructorN =
+               [](void* at, Count count) {
+                  auto atT = static_cast<T*>(at);
+                  for (Count i = 0; i < count; ++i)
+                     atT[i].~T();
+               };
+         }
+      }
+
+      // Relocate instances either at once, or by moving each of them   
+      // and destroying the old one, in the order that is safe in       
+      // case source and destination overlap                            
+      if constexpr (CT::Relocatable<T>) {
+         generated.mRelocatorN =
+            [](void* from, void* to, Count count) noexcept {
+               ::std::memmove(to, from, sizeof(T) * count);
+            };
+      }
+      else if constexpr (CT::MoveMakable<T> and ::std::is_destructible_v<T>) {
+         generated.mRelocatorN =
+            [](void* from, void* to, Count count) {
+               auto fromT = static_cast<T*>(from);
+               auto toT = static_cast<T*>(to);
+               if (toT < fromT) {
+                  for (Count i = 0; i < count; ++i) {
+                     IntentNew(toT + i, Move(fromT[i]));
+                     fromT[i].~T();
+                  }
+               }
+               else if (toT > fromT) {
+                  for (Count i = count; i > 0; --i) {
+                     IntentNew(toT + i - 1, Move(fromT[i - 1]));
+                     fromT[i - 1].~T();
+                  }
+               }
+            };
       }
 
       // Wrap the == operator of the origin type inside a lambda        
@@ -896,6 +1353,28 @@ namespace Langulus::RTTI
                auto t2T = static_cast<const T*>(t2);
                return *t1T == *t2T;
             };
+
+         // Bytes can be compared only if equal values are guaranteed   
+         // to be equal bytes, and == can't be customized               
+         if constexpr (CT::Fundamental<T>
+         and ::std::has_unique_object_representations_v<T>) {
+            generated.mComparerN =
+               [](const void* t1, const void* t2, Count count) noexcept -> bool {
+                  return 0 == ::std::memcmp(t1, t2, sizeof(T) * count);
+               };
+         }
+         else {
+            generated.mComparerN =
+               [](const void* t1, const void* t2, Count count) -> bool {
+                  auto t1T = static_cast<const T*>(t1);
+                  auto t2T = static_cast<const T*>(t2);
+                  for (Count i = 0; i < count; ++i) {
+                     if (not (t1T[i] == t2T[i]))
+                        return false;
+                  }
+                  return true;
+               };
+         }
       }
 
       // Wrap the copy-assignment of the type inside a lambda           
@@ -906,6 +1385,22 @@ namespace Langulus::RTTI
                auto toT = static_cast<T*>(to);
                IntentAssign(*toT, Copy(*fromT));
             };
+
+         if constexpr (CT::POD<T>) {
+            generated.mCopyAssignerN =
+               [](const void* from, void* to, Count count) noexcept {
+                  ::std::memcpy(to, from, sizeof(T) * count);
+               };
+         }
+         else {
+            generated.mCopyAssignerN =
+               [](const void* from, void* to, Count count) {
+                  auto fromT = static_cast<const T*>(from);
+                  auto toT = static_cast<T*>(to);
+                  for (Count i = 0; i < count; ++i)
+                     IntentAssign(toT[i], Copy(fromT[i]));
+               };
+         }
       }
       
       // Wrap the refer-assignment of the type inside a lambda          
@@ -946,6 +1441,22 @@ namespace Langulus::RTTI
                auto toT = static_cast<T*>(to);
                IntentAssign(*toT, Move(*fromT));
             };
+
+         if constexpr (CT::POD<T>) {
+            generated.mMoveAssignerN =
+               [](void* from, void* to, Count count) noexcept {
+                  ::std::memcpy(to, from, sizeof(T) * count);
+               };
+         }
+         else {
+            generated.mMoveAssignerN =
+               [](void* from, void* to, Count count) {
+                  auto fromT = static_cast<T*>(from);
+                  auto toT = static_cast<T*>(to);
+                  for (Count i = 0; i < count; ++i)
+                     IntentAssign(toT[i], Move(fromT[i]));
+               };
+         }
       }
 
       // Wrap the move-assignment of the type inside a lambda           
@@ -974,6 +1485,13 @@ namespace Langulus::RTTI
                auto atT = static_cast<const T*>(at);
                return HashOf(*atT);
             };
+
+         generated.mHasherN =
+            [](const void* at, Count count, Hash* hashes) {
+               auto atT = static_cast<const T*>(at);
+               for (Count i = 0; i < count; ++i)
+                  hashes[i] = HashOf(atT[i]);
+            };
       }
 
       // Wrap the mutable Do verb method inside a lambda                
@@ -1037,6 +1555,7 @@ namespace Langulus::RTTI
    }
 
    /// Set the list of bases for a given meta definition                      
+   /// Bases of bases are flattened later, by GetAncestry                     
    ///   @tparam Args... - all the bases                                      
    template<class T, CT::Dense...BASE>
    void MetaData::SetBases(Types<BASE...>) noexcept {
@@ -1058,7 +1577,55 @@ namespace Langulus::RTTI
          (mAbilities.emplace(
             MetaVerb::Of<VERB>(), Ability::From<T, VERB>()
          ), ...);
+         FreezeAbilities();
+
+         // Index the type in each verb, so that all capable types can  
+         // be found without scanning the registry                      
+         for (auto& [verb, ability] : mAbilities) {
+            #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+               Instance.RegisterAbility(verb, this);
+            #else
+               const_cast<MetaVerb&>(*verb).mAble.insert(this);
+            #endif
+         }
+      }
+   }
+
+   /// Rebuild the dispatch table from the reflected abilities                
+   inline void MetaData::FreezeAbilities() {
+      using Entry = AbilityTable::Entry;
+      ::std::vector<Entry> entries;
+      const auto entry = [&](VMeta verb, const Ability::Signature& signature) -> Entry& {
+         const DMeta argument = signature.empty() ? DMeta {} : signature[0];
+         for (auto& e : entries) {
+            if (e.mVerb == verb and e.mArgument == argument)
+               return e;
+         }
+
+         return entries.emplace_back(Entry {
+            verb->mHash.mHash,
+            argument ? argument->mHash.mHash : 0,
+            verb, argument, {}, {}
+         });
+      };
+
+      for (auto& [verb, ability] : mAbilities) {
+         for (auto& [signature, function] : ability.mOverloadsMutable) {
+            if (signature.size() <= 1)
+               entry(verb, signature).mMutable = function;
+         }
+         for (auto& [signature, function] : ability.mOverloadsConstant) {
+            if (signature.size() <= 1)
+               entry(verb, signature).mConstant = function;
+         }
       }
+
+      ::std::sort(entries.begin(), entries.end(),
+         [](const Entry& lhs, const Entry& rhs) {
+            return lhs.mVerbHash < rhs.mVerbHash or (lhs.mVerbHash == rhs.mVerbHash
+               and lhs.mArgumentHash < rhs.mArgumentHash);
+         });
+      mAbilityTable.mEntries = ::std::move(entries);
    }
 
    /// Set the list of to-converters for a given meta definition              
@@ -1079,9 +1646,12 @@ namespace Langulus::RTTI
             )...
          };
 
-         for (const auto& i : list)
-            if (i.first)
+         for (const auto& i : list) {
+            if (i.first) {
                mConvertersTo.insert(i);
+               AddConversion(*this, i.second, true);
+            }
+         }
       }
    }
    
@@ -1107,12 +1677,45 @@ namespace Langulus::RTTI
             )...
          };
 
-         for (const auto& i : list)
-            if (i.first)
+         for (const auto& i : list) {
+            if (i.first) {
                mConvertersFrom.insert(i);
+               AddConversion(const_cast<MetaData&>(*i.first),
+                  {this, i.second.mFunction}, false);
+            }
+         }
       }
    }
 
+   /// Register a direct conversion in the type that is converted from        
+   /// If conversions in both directions were reflected, this is reported     
+   /// once, and the one reflected in the converted type is preferred         
+   ///   @param from - the origin type that is converted from                 
+   ///   @param converter - the type to convert to, and the function          
+   ///   @param reflectedInFrom - whether the conversion was reflected in     
+   ///                            the type that is converted from             
+   inline void MetaData::AddConversion(
+      MetaData& from, const Converter& converter, bool reflectedInFrom
+   ) noexcept {
+      from.mConversions.update([&](ConverterMap& conversions) {
+         const auto found = conversions.find(converter.mType);
+         if (found == conversions.end()) {
+            conversions.emplace(converter.mType, converter);
+            return;
+         }
+
+         if (found->second.mFunction != converter.mFunction) {
+            Logger::Warning("Ambiguous conversion from ", from.mToken,
+               " to ", converter.mType->mToken, ": conversions in both "
+               "directions were reflected - the one reflected in ",
+               from.mToken, " will be used");
+         }
+
+         if (reflectedInFrom)
+            found->second = converter;
+      });
+   }
+
    /// Register a meta constant definition, and add it to a data definition   
    /// as a named value                                                       
    ///   @param named - the named value definition                            
@@ -1155,127 +1758,256 @@ namespace Langulus::RTTI
       mNamedValues.emplace_back(&cmeta);
    }
 
-   /// Get a converter to a specific type                                     
+   /// Get a direct converter to a specific type                              
    ///   @attention converter assumes destination memory is not initialized   
    ///   @param meta - the type we're converting to                           
-   ///   @return the conversion function                                      
+   ///   @return the conversion function, or nullptr if none was reflected    
    LANGULUS(INLINED)
-   FCopyConstruct MetaData::GetConverter(DMeta meta) const {
+   FCopyConstruct MetaData::GetConverter(DMeta meta) const noexcept {
       const auto lhs = mOrigin;
       const auto rhs = meta ? meta->mOrigin : nullptr;
       if (not lhs or not rhs)
          return {};
 
-      FCopyConstruct convertTo {};
-      const auto foundTo = lhs->mConvertersTo.find(rhs);
-      if (foundTo != lhs->mConvertersTo.end())
-         convertTo = foundTo->second.mFunction;
+      // Conversions reflected in either type end up in here, and       
+      // ambiguities were already resolved while reflecting             
+      return lhs->mConversions.find(rhs);
+   }
+
+   /// Get the cheapest chain of conversions to a specific type               
+   /// Conversions are planned once per pair of types, and are forgotten      
+   /// only when a boundary is unloaded                                       
+   ///   @attention the plan is valid until a boundary is unloaded            
+   ///   @param meta - the type we're converting to                           
+   ///   @return the plan, that is invalid if conversion isn't possible       
+   inline const ConversionPlan& MetaData::GetConversionPlan(DMeta meta) const {
+      static const ConversionPlan none;
+      const auto lhs = mOrigin.operator -> ();
+      const auto rhs = meta ? meta->mOrigin.operator -> () : nullptr;
+      if (not lhs or not rhs)
+         return none;
+      if (lhs != this)
+         return lhs->GetConversionPlan(meta);
 
-      FCopyConstruct convertFrom {};
-      const auto foundFrom = rhs->mConvertersFrom.find(lhs);
-      if (foundFrom != rhs->mConvertersFrom.end())
-         convertFrom = foundFrom->second.mFunction;
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
 
-      if (convertTo or convertFrom) {
-         LANGULUS_ASSERT(not convertTo != not convertFrom, Convert,
-            "Ambiguous conversion", " from ", lhs, " to ", rhs,
-            ": conversions in both directions were reflected"
-            " - not sure which one to pick");
-         return convertTo ? convertTo : convertFrom;
+      static ::std::shared_mutex mutex;
+      {
+         const ::std::shared_lock lock {mutex};
+         if (mConversionPlans.mEpoch == epoch) {
+            const auto found = mConversionPlans.mPlans.find(rhs);
+            if (found != mConversionPlans.mPlans.end())
+               return found->second;
+         }
       }
-      else return {};
-   }
-   
-   /// Get a reflected member by trait, type, and/or offset (inner)           
-   ///   @param trait - filter by trait, or nullptr if trait is irrelevant    
-   ///   @param type - filter by data type, or nullptr if irrelevant          
-   ///   @param offset - considers only matches after that many matches       
-   ///   @return the member interface if found, or nullptr if not             
-   inline const Member* MetaData::GetMemberInner(
-      TMeta trait, DMeta type, Offset& offset
-   ) const noexcept {
-      if (not mOrigin)
-         return nullptr;
 
-      // Search in all bases first                                      
-      for (auto& base : mOrigin->mBases) {
-         const auto found = base.mType->GetMemberInner(trait, type, offset);
-         if (found)
-            return found;
+      // Plan outside the lock, so that readers aren't blocked          
+      auto plan = PlanConversion(rhs);
+      const ::std::unique_lock lock {mutex};
+      if (mConversionPlans.mEpoch != epoch) {
+         mConversionPlans.mPlans.clear();
+         mConversionPlans.mEpoch = epoch;
+      }
+      return mConversionPlans.mPlans.emplace(rhs, ::std::move(plan)).first->second;
+   }
+
+   /// Search for the cheapest chain of conversions to a specific type        
+   /// The graph of all reflected conversions and non-virtual bases is        
+   /// searched breadth-first, so the plan has the least steps possible       
+   ///   @param to - the origin type we're converting to                      
+   ///   @return the plan, that is invalid if conversion isn't possible       
+   inline ConversionPlan MetaData::PlanConversion(const MetaData* to) const {
+      using Step = ConversionPlan::Step;
+
+      // Converting to the same type is just a copy                     
+      if (to == this) {
+         ConversionPlan plan;
+         if (mCopyConstructor)
+            plan.mSteps.push_back({this, {}, 0});
+         return plan;
       }
 
-      // Then locally                                                   
-      for (auto& member : mOrigin->mMembers) {
-         // Eliminate by type                                           
-         if (type and not (member.GetType() & type))
-            continue;
+      struct Visit {
+         const MetaData* mFrom;
+         Step mStep;
+      };
+
+      ::std::unordered_map<const MetaData*, Visit> visited;
+      ::std::vector<const MetaData*> queue {this};
+      visited.emplace(this, Visit {});
+
+      for (Offset head = 0; head < queue.size(); ++head) {
+         const auto node = queue[head];
+
+         // Returns true when the destination is reached                
+         const auto reach = [&](DMeta next, const Step& step) {
+            const auto origin = next ? next->mOrigin.operator -> () : nullptr;
+            if (not origin or not visited.emplace(origin, Visit {node, step}).second)
+               return false;
+            if (origin == to)
+               return true;
+            queue.push_back(origin);
+            return false;
+         };
+
+         bool reached = node->mConversions.view([&](const ConverterMap& conversions) {
+            for (auto& [type, converter] : conversions) {
+               if (reach(type, {converter.mType, converter.mFunction, 0}))
+                  return true;
+            }
+            return false;
+         });
+
+         for (auto& base : node->mBases) {
+            if (reached)
+               break;
 
-         // Eliminate by tag                                            
-         if (trait) {
-            int tagIndex = 0;
-            TMeta tag;
-            do tag = member.GetTrait(tagIndex++);
-            while (tag and tag != trait);
-            if (tag != trait)
+            // Imposed bases aren't real, and virtual bases have no     
+            // fixed offset. A base can also be the result only if it   
+            // can be copied out                                        
+            if (base.mImposed or base.mVirtualBase or not base.mType)
+               continue;
+            if (base.mType->mOrigin.operator -> () == to and not to->mCopyConstructor)
                continue;
+            reached = reach(base.mType, {base.mType, {}, base.mOffset});
          }
 
-         // Match found                                                 
-         if (0 == offset)
-            return &member;
+         if (not reached)
+            continue;
 
-         // Offset not reached yet                                      
-         --offset;
+         // Walk back from the destination, to collect the steps        
+         ConversionPlan plan;
+         for (auto at = to; at != this; at = visited.at(at).mFrom)
+            plan.mSteps.push_back(visited.at(at).mStep);
+         ::std::reverse(plan.mSteps.begin(), plan.mSteps.end());
+         return plan;
       }
 
-      // Nothing was found                                              
-      return nullptr;
+      return {};
    }
-
-   /// Get member count by matching trait, type, and/or offset (inner)        
-   ///   @param trait - filter by trait, or nullptr if trait is irrelevant    
-   ///   @param type - filter by data type, or nullptr if irrelevant          
-   ///   @param offset - considers only matches after that many matches       
-   ///   @return the member interface if found, or nullptr if not             
-   inline Count MetaData::GetMemberCountInner(
-      TMeta trait, DMeta type, Offset& offset
-   ) const noexcept {
+   
+   /// Get all members of the type, including inherited ones                  
+   /// The table is built on first use, because types of members aren't       
+   /// guaranteed to be reflected at the time the owner is reflected. It is   
+   /// rebuilt on first use after a boundary is unloaded, because the types   
+   /// and traits of members might have been unloaded with it                 
+   ///   @return the member table of the origin type                          
+   inline const MemberTable& MetaData::GetMemberTable() const {
+      static const MemberTable none;
       if (not mOrigin)
-         return 0;
+         return none;
+      if (mOrigin.operator -> () != this)
+         return mOrigin->GetMemberTable();
 
-      // Search in all bases first                                      
-      Count result = 0;
-      for (auto& base : mOrigin->mBases)
-         result += base.mType->GetMemberCountInner(trait, type, offset);
-
-      // Then locally                                                   
-      for (auto& member : mOrigin->mMembers) {
-         // Eliminate by type                                           
-         if (type and not (member.GetType() & type))
-            continue;
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
 
-         // Eliminate by tag                                            
-         if (trait) {
-            int tagIndex = 0;
-            TMeta tag;
-            do tag = member.GetTrait(tagIndex++);
-            while (tag and tag != trait);
-            if (tag != trait)
-               continue;
+      ::std::atomic_ref<const MemberTable*> latest {mMemberTables.mLatest};
+      auto built = latest.load(::std::memory_order_acquire);
+      if (built and built->mEpoch == epoch)
+         return *built;
+
+      // Tables of bases are built while the lock is held, hence the    
+      // recursive mutex                                                
+      static ::std::recursive_mutex mutex;
+      const ::std::lock_guard lock {mutex};
+      built = latest.load(::std::memory_order_relaxed);
+      if (built and built->mEpoch == epoch)
+         return *built;
+
+      // Members of bases first, in the order they're searched in       
+      auto fresh = ::std::make_unique<MemberTable>();
+      auto& table = *fresh;
+      bool reflected = mIsReflected;
+      for (auto& base : mBases) {
+         const auto& inherited = base.mType->GetMemberTable();
+         if (base.mType->mOrigin)
+            reflected = reflected and inherited.mEpoch == epoch;
+         for (auto member : inherited.mMembers) {
+            if (base.mVirtualBase or member.mOffset == Member::NoOffset)
+               member.mOffset = Member::NoOffset;
+            else
+               member.mOffset += base.mOffset;
+            table.mMembers.emplace_back(::std::move(member));
          }
+      }
 
-         // Match found                                                 
-         if (0 == offset) {
-            ++result;
-            continue;
-         }
+      // Then the local ones                                            
+      for (auto& member : mMembers) {
+         ResolvedMember resolved;
+         resolved.mMember = &member;
+         resolved.mType = member.GetType();
+         resolved.mOffset = member.mOffset;
+         for (int i = 0; auto trait = member.GetTrait(i); ++i)
+            resolved.mTraits.emplace_back(trait);
+         table.mMembers.emplace_back(::std::move(resolved));
+      }
 
-         // Offset not reached yet                                      
-         --offset;
+      // Index them by hashes, keeping the order of members for each    
+      // hash, so that n-th match is still the n-th member searched     
+      for (Count i = 0; i < table.mMembers.size(); ++i) {
+         auto& member = table.mMembers[i];
+         if (member.mType)
+            table.mByType.emplace_back(member.mType->mDecvq->mHash.mHash, i);
+         for (auto& trait : member.mTraits)
+            table.mByTrait.emplace_back(trait->mHash.mHash, i);
       }
 
-      // Nothing was found                                              
-      return result;
+      for (auto index : {&table.mByType, &table.mByTrait}) {
+         ::std::sort(index->begin(), index->end());
+         index->erase(::std::unique(index->begin(), index->end()), index->end());
+      }
+
+      // A table that was built too early is rebuilt on next use, and   
+      // the replaced table is kept, because it might still be in use   
+      table.mEpoch = reflected ? epoch : 0;
+      mMemberTables.mBuilt.emplace_back(::std::move(fresh));
+      latest.store(&table, ::std::memory_order_release);
+      return table;
+   }
+
+   /// Visit members matching trait and/or type, in the order they're         
+   /// searched in, until the visitor returns false                           
+   ///   @param trait - filter by trait, or nullptr if trait is irrelevant    
+   ///   @param type - filter by data type, or nullptr if irrelevant          
+   ///   @param call - the visitor, taking a ResolvedMember                   
+   template<class F>
+   void MetaData::ForEachMember(TMeta trait, DMeta type, F&& call) const noexcept {
+      const auto& table = GetMemberTable();
+      if (not trait and not type) {
+         for (auto& member : table.mMembers) {
+            if (not call(member))
+               return;
+         }
+         return;
+      }
+
+      // Narrow down by trait if possible, because members usually      
+      // have more distinct traits than types. Hashes might collide,    
+      // so each candidate is still checked                             
+      const auto& index = trait ? table.mByTrait : table.mByType;
+      const auto hash = trait ? trait->mHash.mHash : type->mDecvq->mHash.mHash;
+      auto it = ::std::lower_bound(index.begin(), index.end(),
+         MemberTable::Index::value_type {hash, 0});
+
+      for (; it != index.end() and it->first == hash; ++it) {
+         auto& member = table.mMembers[it->second];
+         if (type and not (member.mType & type))
+            continue;
+         if (trait and not member.HasTrait(trait))
+            continue;
+         if (not call(member))
+            return;
+      }
    }
 
    /// Get a reflected member by trait, type, and/or offset                   
@@ -1287,7 +2019,19 @@ namespace Langulus::RTTI
    const Member* MetaData::GetMember(
       TMeta trait, DMeta type, Offset offset
    ) const noexcept {
-      return GetMemberInner(trait, type, offset);
+      if (not trait and not type) {
+         const auto& members = GetMemberTable().mMembers;
+         return offset < members.size() ? members[offset].mMember : nullptr;
+      }
+
+      const Member* result = nullptr;
+      ForEachMember(trait, type, [&](const ResolvedMember& member) {
+         if (offset-- > 0)
+            return true;
+         result = member.mMember;
+         return false;
+      });
+      return result;
    }
 
    /// Count the number of matching reflected members                         
@@ -1299,19 +2043,21 @@ namespace Langulus::RTTI
    Count MetaData::GetMemberCount(
       TMeta trait, DMeta type, Offset offset
    ) const noexcept {
-      return GetMemberCountInner(trait, type, offset);
+      Count matches = 0;
+      if (not trait and not type)
+         matches = GetMemberTable().mMembers.size();
+      else ForEachMember(trait, type, [&](const ResolvedMember&) {
+         ++matches;
+         return true;
+      });
+      return matches > offset ? matches - offset : 0;
    }
 
    /// Count the number of reflected members, in non-imposed bases included   
    ///   @return the number of members                                        
-   inline Count MetaData::GetMemberCount() const noexcept {
-      if (not mOrigin)
-         return 0;
-
-      Count result = mOrigin->mMembers.size();
-      for (auto& base : mOrigin->mBases)
-         result += base.mType->GetMemberCount();
-      return result;
+   LANGULUS(INLINED)
+   Count MetaData::GetMemberCount() const noexcept {
+      return GetMemberTable().mMembers.size();
    }
 
    /// Get the most concrete type                                             
@@ -1335,8 +2081,107 @@ namespace Langulus::RTTI
    }
 #endif
 
+   /// Get all bases of the type, including bases of bases                    
+   /// The ancestry is built on first use, because bases might still be       
+   /// reflecting at the time they're set. It is rebuilt on first use after a 
+   /// boundary is unloaded, or if it was built before the type and all of    
+   /// its ancestors were reflected                                           
+   ///   @return the ancestry of the origin type                              
+   inline const Ancestry& MetaData::GetAncestry() const {
+      static const Ancestry none;
+      if (not mOrigin)
+         return none;
+      if (mOrigin.operator -> () != this)
+         return mOrigin->GetAncestry();
+
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
+
+      ::std::atomic_ref<const Ancestry*> latest {mAncestries.mLatest};
+      auto built = latest.load(::std::memory_order_acquire);
+      if (built and built->mEpoch == epoch)
+         return *built;
+
+      // Ancestries of bases are built while the lock is held, hence    
+      // the recursive mutex                                            
+      static ::std::recursive_mutex mutex;
+      const ::std::lock_guard lock {mutex};
+      built = latest.load(::std::memory_order_relaxed);
+      if (built and built->mEpoch == epoch)
+         return *built;
+
+      auto fresh = ::std::make_unique<Ancestry>();
+      auto& ancestry = *fresh;
+      bool reflected = mIsReflected;
+
+      // Imposed bases don't count towards distance                     
+      auto& distances = ancestry.mDistances;
+      const auto addDistance = [&](::std::uint32_t index, int distance) {
+         const auto found = ::std::lower_bound(
+            distances.begin(), distances.end(), index,
+            [](const auto& entry, ::std::uint32_t i) {
+               return entry.first < i;
+            }
+         );
+         if (found == distances.end() or found->first != index)
+            distances.insert(found, {index, distance});
+         else if (distance < found->second)
+            found->second = distance;
+      };
+
+      // Each base is followed by its own ancestors                     
+      for (auto& b : mBases) {
+         ancestry.mAncestors.push_back(b);
+         if (not b.mType->mOrigin)
+            continue;
+
+         const auto& inherited = b.mType->GetAncestry();
+         reflected = reflected and inherited.mEpoch == epoch;
+         for (auto local : inherited.mAncestors) {
+            local.mOffset += b.mOffset;
+            local.mCount *= b.mCount;
+            local.mBinaryCompatible = b.mBinaryCompatible
+                              and local.mBinaryCompatible;
+            local.mImposed = b.mImposed or local.mImposed;
+            local.mVirtualBase = b.mVirtualBase or local.mVirtualBase;
+            ancestry.mAncestors.push_back(local);
+         }
+
+         if (b.mImposed)
+            continue;
+
+         addDistance(b.mType->mOrigin->mIndex, 1);
+         for (auto& distance : inherited.mDistances)
+            addDistance(distance.first, distance.second + 1);
+      }
+
+      // Encode the set of ancestors for subtype checks                 
+      for (auto& b : ancestry.mAncestors) {
+         if (not b.mType->mOrigin)
+            continue;
+
+         const auto index = b.mType->mOrigin->mIndex;
+         ancestry.mIndices.push_back(index);
+         ancestry.mMask |= ::std::uint64_t {1} << (index % 64);
+      }
+
+      auto& indices = ancestry.mIndices;
+      ::std::sort(indices.begin(), indices.end());
+      indices.erase(::std::unique(indices.begin(), indices.end()), indices.end());
+
+      // An ancestry that was built too early is rebuilt on next use    
+      ancestry.mEpoch = reflected ? epoch : 0;
+      mAncestries.mBuilt.push_back(::std::move(fresh));
+      latest.store(mAncestries.mBuilt.back().get(), ::std::memory_order_release);
+      return ancestry;
+   }
+
    /// Get a reflected base linked to this meta data definition               
-   /// Traverses the whole inheritance tree, so can return distant bases      
+   /// Searches the whole inheritance tree, so can return distant bases       
    ///   @param type - the type of base to search for, nullptr for any        
    ///   @param offset - use this to get bases by index                       
    ///   @param base - [in/out] base info ends up here if found               
@@ -1346,34 +2191,15 @@ namespace Langulus::RTTI
          return false;
 
       Count scanned = 0;
-      for (auto& b : mOrigin->mBases) {
-         // Check base                                                  
-         if (type->IsExact(b.mType)) {
-            if (scanned == offset) {
-               base = b;
-               return true;
-            }
-            else ++scanned;
-         }
+      for (auto& b : GetAncestry().mAncestors) {
+         if (not type->IsExact(b.mType))
+            continue;
 
-         // Dig deeper                                                  
-         Base local;
-         Offset index = 0;
-         while (b.mType->GetBase(type, index, local)) {
-            if (scanned == offset) {
-               local.mOffset += b.mOffset;
-               local.mCount *= b.mCount;
-               local.mBinaryCompatible = b.mBinaryCompatible
-                                 and local.mBinaryCompatible;
-               local.mImposed = b.mImposed or local.mImposed;
-               local.mVirtualBase = b.mVirtualBase or local.mVirtualBase;
-               base = local;
-               return true;
-            }
-            else ++scanned;
-            
-            ++index;
+         if (scanned == offset) {
+            base = b;
+            return true;
          }
+         else ++scanned;
       }
 
       return false;
@@ -1391,19 +2217,31 @@ namespace Langulus::RTTI
    }
 
    /// A simple check if a reflected base is linked to this meta data         
-   /// Traverses the whole inheritance tree, so can return distant bases      
+   /// Considers the whole inheritance tree, so can return distant bases      
    ///   @param type - the type of base to search for                         
    ///   @return true if a base is available                                  
-   inline bool MetaData::HasBase(DMeta type) const {
-      if (not mOrigin or not type)
+   LANGULUS(INLINED)
+   bool MetaData::HasBase(DMeta type) const {
+      if (not mOrigin or not type or not type->mOrigin)
          return false;
 
-      for (auto& b : mOrigin->mBases) {
-         if (type->Is(b.mType) or b.mType->HasBase(type))
-            return true;
+      const auto& ancestry = GetAncestry();
+      const auto index = type->mOrigin->mIndex;
+      if (index == NoIndex) {
+         // Not indexed yet, so compare ancestors as definitions        
+         for (auto& b : ancestry.mAncestors) {
+            if (b.mType->mOrigin and b.mType->mOrigin->IsExact(type->mOrigin))
+               return true;
+         }
+         return false;
       }
 
-      return false;
+      if (not (ancestry.mMask & (::std::uint64_t {1} << (index % 64))))
+         return false;
+
+      return ::std::binary_search(
+         ancestry.mIndices.begin(), ancestry.mIndices.end(), index
+      );
    }
    
    /// A simple check if a reflected base is linked to this meta data         
@@ -1456,40 +2294,28 @@ namespace Langulus::RTTI
    ///   @return the functor if found                                         
    template<bool MUTABLE>
    auto MetaData::GetAbility(VMeta vmeta, DMeta dmeta) const {
-      const auto foundv = mAbilities.find(vmeta);
-      if constexpr (MUTABLE) {
-         if (foundv != mAbilities.end()) {
-            const auto& overloads = foundv->second.mOverloadsMutable;
-            auto foundo = overloads.find({dmeta});
-            if (foundo != overloads.end()) {
-               // Specific overload is available                        
-               return foundo->second;
-            }
+      using F = Conditional<MUTABLE, FVerbMutable, FVerbConstant>;
+      const auto pick = [](const AbilityTable::Entry* found) -> F {
+         if (not found)
+            return {};
+         if constexpr (MUTABLE)
+            return found->mMutable;
+         else
+            return found->mConstant;
+      };
 
-            // Always fallback to default function, if reflected        
-            foundo = overloads.find({});
-            if (foundo != overloads.end())
-               return foundo->second;
-         }
-      }
-      else {
-         if (foundv != mAbilities.end()) {
-            const auto& overloads = foundv->second.mOverloadsConstant;
-            auto foundo = overloads.find({dmeta});
-            if (foundo != overloads.end()) {
-               // Specific overloads is available                       
-               return foundo->second;
-            }
+      if (dmeta) {
+         // Specific overload is available                              
+         if (const auto specific = pick(mAbilityTable.Find(vmeta, dmeta)))
+            return specific;
 
-            // Always fallback to default function, if reflected        
-            foundo = overloads.find({});
-            if (foundo != overloads.end())
-               return foundo->second;
-         }
+         // Otherwise rank the overloads that might accept it, which    
+         // also falls back to the default function                     
+         return ResolveAbility<MUTABLE>(vmeta, &dmeta, 1);
       }
 
-      // No match found, if reached                                     
-      return FVerbMutable {};
+      // Always fallback to default function, if reflected              
+      return pick(mAbilityTable.Find(vmeta, {}));
    }
 
    /// Get an ability with static verb                                        
@@ -1513,7 +2339,33 @@ namespace Langulus::RTTI
    auto MetaData::GetAbility() const {
       static_assert(CT::DerivedFrom<V, ::Langulus::Flow::Verb>,
          "V must be derived from Flow::Verb");
-      return GetAbility<MUTABLE>(MetaVerb::Of<V>(), MetaData::Of<A>()...);
+      const auto vmeta = MetaVerb::Of<V>();
+      if constexpr (sizeof...(A) == 0)
+         return GetAbility<MUTABLE>(vmeta, DMeta {});
+      else if constexpr (sizeof...(A) == 1)
+         return GetAbility<MUTABLE>(vmeta, MetaData::Of<A>()...);
+      else {
+         const DMeta arguments[] {MetaData::Of<A>()...};
+         return ResolveAbility<MUTABLE>(vmeta, arguments, sizeof...(A));
+      }
+   }
+
+   /// Get the overload of an ability, that fits some arguments best          
+   /// Arguments don't have to match exactly - see Ability::Resolve. The      
+   /// result is remembered in the OverloadCache of the calling thread        
+   ///   @tparam MUTABLE - whether to get mutable/immutable overload          
+   ///   @param vmeta - the type of the verb                                  
+   ///   @param arguments - the types of the verb's arguments                 
+   ///   @param count - the number of arguments                               
+   ///   @return the functor if found                                         
+   template<bool MUTABLE> LANGULUS(INLINED)
+   auto MetaData::ResolveAbility(VMeta vmeta, const DMeta* arguments, Count count) const {
+      return OverloadCache::Get<MUTABLE>(this, vmeta, arguments, count, [&] {
+         using F = Conditional<MUTABLE, FVerbMutable, FVerbConstant>;
+         const auto found = mAbilities.find(vmeta);
+         return found != mAbilities.end()
+            ? found->second.template Resolve<MUTABLE>(arguments, count) : F {};
+      });
    }
 
    /// Get the token of a reflected named value                               
@@ -1535,14 +2387,34 @@ namespace Langulus::RTTI
    }
 
    /// Check if this type interprets as another without conversion            
+   /// The answer is cached in the RelationCache                              
    ///	@tparam BINARY_COMPATIBLE - do we require for the other to be        
    ///      binary compatible with this                                       
    ///   @tparam ADVANCED - whether or not to do an advanced search in the    
    ///      opposite inheritance order                                        
    ///	@param other - the type to try interpreting as                       
    ///	@return true if this type interprets as other                        
-   template<bool BINARY_COMPATIBLE, bool ADVANCED>
+   template<bool BINARY_COMPATIBLE, bool ADVANCED> LANGULUS(INLINED)
    bool MetaData::CastsTo(DMeta other) const {
+      constexpr auto query = static_cast<RelationCache::Query>(
+         RelationCache::CastsTo
+         + (BINARY_COMPATIBLE ? 1 : 0)
+         + (ADVANCED ? 2 : 0)
+      );
+      return RelationCache::Get(this, other.operator -> (), query, [&] {
+         return CastsToInner<BINARY_COMPATIBLE, ADVANCED>(other);
+      });
+   }
+
+   /// Check if this type interprets as another without conversion (inner)    
+   ///	@tparam BINARY_COMPATIBLE - do we require for the other to be        
+   ///      binary compatible with this                                       
+   ///   @tparam ADVANCED - whether or not to do an advanced search in the    
+   ///      opposite inheritance order                                        
+   ///	@param other - the type to try interpreting as                       
+   ///	@return true if this type interprets as other                        
+   template<bool BINARY_COMPATIBLE, bool ADVANCED>
+   bool MetaData::CastsToInner(DMeta other) const {
       if (Is(other))
          return true;
 
@@ -1649,10 +2521,23 @@ namespace Langulus::RTTI
    }
 
    /// Check if this type is either same, base or a derivation of other       
+   /// The answer is cached in the RelationCache                              
    ///   @param other - the type to check                                     
    ///   @return true if this type is related to other                        
    LANGULUS(INLINED)
    bool MetaData::IsRelatedTo(DMeta other) const {
+      const auto query = RelationCache::RelatedTo;
+      return RelationCache::Get(this, other.operator -> (), query, [&] {
+         return IsRelatedToInner(other);
+      });
+   }
+
+   /// Check if this type is either same, base or a derivation of other       
+   /// (inner)                                                                
+   ///   @param other - the type to check                                     
+   ///   @return true if this type is related to other                        
+   LANGULUS(INLINED)
+   bool MetaData::IsRelatedToInner(DMeta other) const {
       return Is(other) or HasBase(other) or HasDerivation(other);
    }
    
@@ -1668,24 +2553,70 @@ namespace Langulus::RTTI
    }
 
    /// Get the number of conversions required to map one type to another      
+   /// The answer is cached in the RelationCache                              
+   ///   @param other - the type to check distance to                         
+   ///   @return the distance                                                 
+   LANGULUS(INLINED)
+   MetaData::Distance MetaData::GetDistanceTo(DMeta other) const {
+      const auto query = RelationCache::DistanceTo;
+      return Distance {RelationCache::Get(this, other.operator -> (), query, [&] {
+         return static_cast<int>(GetDistanceToInner(other));
+      })};
+   }
+
+   /// Get the number of conversions required to map one type to another      
+   /// (inner)                                                                
    ///   @param other - the type to check distance to                         
    ///   @return the distance                                                 
-   inline MetaData::Distance MetaData::GetDistanceTo(DMeta other) const {
+   LANGULUS(INLINED)
+   MetaData::Distance MetaData::GetDistanceToInner(DMeta other) const {
       if (Is(other))
          return Distance{0};
+      if (not other or not other->mOrigin)
+         return Distance::Infinite;
 
-      // Check bases                                                    
-      Distance jumps = Distance::Infinite;
-      for (auto& b : mBases) {
-         if (b.mImposed)
-            continue;
+      // Distances to all ancestors are precomputed                     
+      const auto& distances = GetAncestry().mDistances;
+      const auto index = other->mOrigin->mIndex;
+      const auto found = ::std::lower_bound(
+         distances.begin(), distances.end(), index,
+         [](const auto& entry, ::std::uint32_t i) {
+            return entry.first < i;
+         }
+      );
 
-         auto d = b.mType->GetDistanceTo(other);
-         if (d != Distance::Infinite and d + 1 < jumps)
-            jumps = Distance{d + 1};
-      }
+      if (found == distances.end() or found->first != index)
+         return Distance::Infinite;
+      return Distance{found->second};
+   }
+
+   /// Get the number of conversions required to map one type to many others  
+   /// Useful for ranking overloads, because it bypasses the RelationCache    
+   ///   @param types - the types to check distance to                        
+   ///   @param count - the number of types                                   
+   ///   @param distances - [out] the distance to each type ends up here      
+   inline void MetaData::GetDistancesTo(
+      const DMeta* types, Count count, Distance* distances
+   ) const {
+      for (Offset i = 0; i < count; ++i)
+         distances[i] = GetDistanceToInner(types[i]);
+   }
 
-      return jumps;
+   /// Get the dense index of an origin type, assigning a new one, if the     
+   /// token is encountered for the first time                                
+   ///   @param token - the token of the origin type                          
+   ///   @return the index                                                    
+   LANGULUS(INLINED)
+   ::std::uint32_t MetaData::IndexOf(const Token& token) {
+   #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+      return Instance.GetDataIndex(token);
+   #else
+      static ::std::mutex mutex;
+      static TokenMap<::std::uint32_t> indices;
+      const ::std::unique_lock lock {mutex};
+      const auto next = static_cast<::std::uint32_t>(indices.size());
+      return *indices.insert({ToLowercase(token), next}).first;
+   #endif
    }
    
    /// Get the number of conversions required to map one type to another      
@@ -1710,11 +2641,20 @@ namespace Langulus::RTTI
 
    /// Check if origins match                                                 
    /// Disregards all cv-qualifires, pointers, array extents, etc.            
+   /// Origins are compared by dense index, unless one of them isn't indexed  
+   /// yet, in which case they're compared as definitions                     
    ///   @param other - the type to compare against                           
    ///   @return true if types match                                          
    LANGULUS(INLINED)
    constexpr bool MetaData::Is(DMeta other) const noexcept {
-      return mOrigin and other and mOrigin->IsExact(other->mOrigin);
+      if (not mOrigin or not other or not other->mOrigin)
+         return false;
+
+      const auto index = mOrigin->mIndex;
+      const auto otherIndex = other->mOrigin->mIndex;
+      if (index == NoIndex or otherIndex == NoIndex)
+         return mOrigin->IsExact(other->mOrigin);
+      return index == otherIndex;
    }
    
    /// Check if this type matches any of the provided types' origins and      
@@ -1757,7 +2697,22 @@ namespace Langulus::RTTI
    ///   @return true if types match                                          
    LANGULUS(INLINED)
    constexpr bool MetaData::IsExact(DMeta other) const noexcept {
-      return other and mHash == other->mHash and mToken == other->mToken;
+      if (not other)
+         return false;
+
+   #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+      // The registry makes sure that definitions of the same type in   
+      // different boundaries share the same canonical definition       
+      const bool exact = GetCanonical() == other->GetCanonical();
+      LANGULUS_ASSUME(DevAssumes, exact
+         or mHash != other->mHash or mToken != other->mToken,
+         "Definitions of the same type aren't canonicalized: ", mToken);
+      return exact;
+   #else
+      // Each translation unit keeps its own definitions                
+      return this == other.operator -> ()
+         or (mHash == other->mHash and mToken == other->mToken);
+   #endif
    }
 
    /// Get a size based on reflected allocation page and count (unsafe)       
@@ -1773,6 +2728,107 @@ namespace Langulus::RTTI
       return result;
    }
 
+   /// Get a cached relation between two definitions, or compute and cache it 
+   /// Relations are cached only after both definitions finish reflecting     
+   ///   @param from - the definition the query is made on                    
+   ///   @param to - the definition the query is about                        
+   ///   @param query - the kind of relation                                  
+   ///   @param compute - computes the relation on a miss                     
+   ///   @return the relation                                                 
+   template<class F> LANGULUS(INLINED)
+   int RelationCache::Get(const MetaData* from, const MetaData* to, Query query, F&& compute) {
+      static thread_local Entry table[Size] {};
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
+
+      const auto a = reinterpret_cast<::std::uintptr_t>(from);
+      const auto b = reinterpret_cast<::std::uintptr_t>(to);
+      const auto slot = ((a ^ (b * 0x9E3779B97F4A7C15ull)) >> 4 ^ query) % Size;
+
+      auto& entry = table[slot];
+      if (entry.mEpoch == epoch and entry.mFrom == from
+      and entry.mTo == to and entry.mQuery == query) {
+         Counters::Hit();
+         return entry.mResult;
+      }
+
+      Counters::Miss();
+      const int result = compute();
+
+      // Don't remember anything about definitions, that are still      
+      // being reflected, or whose origin is still being reflected      
+      const auto reflected = [](const MetaData* meta) noexcept {
+         return not meta or (meta->mIsReflected
+            and (not meta->mOrigin or meta->mOrigin->mIsReflected));
+      };
+
+      if (reflected(from) and reflected(to))
+         entry = {from, to, epoch, result, query};
+      return result;
+   }
+
+   /// Get a cached overload for a signature, or resolve and cache it         
+   ///   @tparam MUTABLE - whether the overload is mutable/immutable          
+   ///   @param type - the definition the overload is searched in             
+   ///   @param verb - the verb of the overload                               
+   ///   @param arguments - the types of the arguments                        
+   ///   @param count - the number of arguments                               
+   ///   @param compute - resolves the overload on a miss                     
+   ///   @return the overload                                                 
+   template<bool MUTABLE, class F> LANGULUS(INLINED)
+   auto OverloadCache::Get(
+      const MetaData* type, VMeta verb, const DMeta* arguments, Count count, F&& compute
+   ) {
+      if (count > MaxArguments) {
+         Counters::Miss();
+         return compute();
+      }
+
+      static thread_local Entry<MUTABLE> table[Size] {};
+      #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         const auto epoch = Instance.GetEpoch();
+      #else
+         // Nothing is ever unloaded                                    
+         constexpr Count epoch = 1;
+      #endif
+
+      const auto vmeta = verb.operator -> ();
+      auto slot = reinterpret_cast<::std::uintptr_t>(type)
+                ^ reinterpret_cast<::std::uintptr_t>(vmeta) * 0x9E3779B97F4A7C15ull;
+      for (Offset i = 0; i < count; ++i) {
+         slot ^= reinterpret_cast<::std::uintptr_t>(arguments[i].operator -> ());
+         slot *= 0x9E3779B97F4A7C15ull;
+      }
+
+      auto& entry = table[(slot >> 4) % Size];
+      if (entry.mEpoch == epoch and entry.mType == type
+      and entry.mVerb == vmeta and entry.mCount == count) {
+         Offset i = 0;
+         while (i < count and entry.mArguments[i] == arguments[i].operator -> ())
+            ++i;
+
+         if (i == count) {
+            Counters::Hit();
+            return entry.mFunction;
+         }
+      }
+
+      Counters::Miss();
+      const auto result = compute();
+      entry.mType = type;
+      entry.mVerb = vmeta;
+      for (Offset i = 0; i < count; ++i)
+         entry.mArguments[i] = arguments[i].operator -> ();
+      entry.mCount = count;
+      entry.mEpoch = epoch;
+      entry.mFunction = result;
+      return result;
+   }
+
 } // namespace Langulus::RTTI
 
 #undef VERBOSE
@@ -29,7 +29,7 @@ namespace Langulus::RTTI
 
    public:
       MetaTrait(const Token& token)
-         : Meta {token} {
+         : Meta {token, MetaKind::Trait} {
          mTokenSanitized = ToLastToken(mToken);
          mTokenSanitized[0] = ::std::tolower(mTokenSanitized[0]);
       }
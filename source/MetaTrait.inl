@@ -63,13 +63,22 @@ namespace Langulus::RTTI
       static_assert(token != "", "Invalid trait token is not allowed");
 
       #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         // Each thread keeps a cached pointer to the definition, but   
+         // it is valid only for the registry epoch it was retrieved    
+         // in, because the library that defined it might be reloaded,  
+         // and thus produce new pointer.                               
+         static thread_local RTTI::MetaCache<TMeta> cache;
+         const auto epoch = Instance.GetEpoch();
+         if (cache.mEpoch == epoch)
+            return cache.mMeta;
+
          // Try to get the definition, type might have been reflected   
-         // previously in another library. Unfortunately we can't keep  
-         // a static pointer to the meta, because forementioned library 
-         // might be reloaded, and thus produce new pointer.            
+         // previously in another library                               
          TMeta meta = Instance.GetMetaTrait(token, RTTI::Boundary);
-         if (meta)
+         if (meta) {
+            cache = {meta, epoch};
             return meta;
+         }
       #else
          // Keep a static meta pointer for each translation unit        
          static constinit ::std::unique_ptr<MetaTrait> meta;
@@ -82,6 +91,7 @@ namespace Langulus::RTTI
       // reflection function might end up forever looping otherwise     
       #if LANGULUS_FEATURE(MANAGED_REFLECTION)
          meta = Instance.RegisterTrait(token, RTTI::Boundary);
+         cache = {meta, epoch};
          MetaTrait& generated = const_cast<MetaTrait&>(*meta);
       #else
          meta = ::std::make_unique<MetaTrait>(token);
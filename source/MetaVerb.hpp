@@ -7,7 +7,10 @@
 ///                                                                           
 #pragma once
 #include "Meta.hpp"
-#include <unordered_set>
+#include "Reclaimer.hpp"
+#include <vector>
+#include <memory>
+#include <mutex>
 
 
 namespace Langulus::RTTI
@@ -17,7 +20,50 @@ namespace Langulus::RTTI
    using FDefaultVerbMutable  = bool (*)(Anyness::Many&, Flow::Verb&);
    using FDefaultVerbConstant = bool (*)(const Anyness::Many&, Flow::Verb&);
    using FStatelessVerb = bool (*)(Flow::Verb&);
-   using AbleList = ::std::unordered_set<DMeta>;
+
+
+   ///                                                                        
+   ///   Set of data types that are capable of doing a verb                   
+   ///                                                                        
+   /// A flat vector of definitions, sorted by their addresses, so that       
+   /// fanning a verb out to all capable types is a linear walk. Types are    
+   /// inserted while their abilities are reflected, and erased when their    
+   /// boundary is unloaded.                                                  
+   ///   The vector is never modified once published - inserting or erasing   
+   /// publishes a modified copy, and retires the replaced one in the given   
+   /// reclaimer. Without a reclaimer, replaced vectors are kept until the    
+   /// list is destroyed, because nothing tells when readers are done         
+   ///                                                                        
+   class AbleList {
+   public:
+      using List = ::std::vector<DMeta>;
+
+   private:
+      // The latest vector, or nullptr if no type was ever inserted     
+      ::std::atomic<const List*> mList = nullptr;
+      // Replaced vectors, if they weren't retired in a reclaimer       
+      ::std::vector<::std::unique_ptr<const List>> mReplaced;
+
+      NOD() static auto LowerBound(const List&, DMeta) noexcept;
+      void Publish(::std::unique_ptr<const List>, Reclaimer*);
+
+   public:
+      AbleList() = default;
+      AbleList(const AbleList&) = delete;
+      AbleList& operator = (const AbleList&) = delete;
+
+      ~AbleList() {
+         delete mList.load(::std::memory_order_relaxed);
+      }
+
+      NOD() const List& load() const noexcept;
+      NOD() Count size() const noexcept { return load().size(); }
+      NOD() bool empty() const noexcept { return load().empty(); }
+
+      NOD() bool contains(DMeta) const noexcept;
+      bool insert(DMeta, Reclaimer* = nullptr);
+      Count erase(DMeta, Reclaimer*);
+   };
 
 
    ///                                                                        
@@ -49,12 +95,12 @@ namespace Langulus::RTTI
       // Reflected stateless verb, if available                         
       FStatelessVerb mStatelessInvocation {};
 
-      // A set of data types that are capable of doing the verb (TODO)  
+      // A set of data types that are capable of doing the verb         
       AbleList mAble;
 
    public:
       MetaVerb(const Token& tp, const Token& tn, const Token& op, const Token& on)
-         : Meta {tp}
+         : Meta {tp, MetaKind::Verb}
          , mTokenReverse {tn}
          , mOperator {op}
          , mOperatorReverse {on} {}
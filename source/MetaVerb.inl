@@ -7,6 +7,8 @@
 ///                                                                           
 #pragma once
 #include "MetaVerb.hpp"
+#include <algorithm>
+#include <functional>
 
 #if 0
    #define VERBOSE(...) Logger::Verbose("RTTI: ", __VA_ARGS__)
@@ -18,11 +20,11 @@
 namespace Langulus::RTTI
 {
 
-   /// Isolate and lowercase an operator token                                
+   /// Isolate an operator token, by trimming any whitespace around it        
    ///   @param token - the operator                                          
-   ///   @return the lowercased and isolated operator token                   
+   ///   @return the isolated operator token, viewing into the original       
    LANGULUS(INLINED)
-   Lowercase IsolateOperator(const Token& token) noexcept {
+   Token IsolateOperator(const Token& token) noexcept {
       // Skip skippable at the front and the back of token              
       auto l = token.data();
       auto r = token.data() + token.size();
@@ -32,8 +34,102 @@ namespace Langulus::RTTI
       while (r > l and *(r-1) <= 32)
          --r;
 
-      // Lowercase the isolated token                                   
-      return ToLowercase(token.substr(l - token.data(), r - l));
+      return token.substr(l - token.data(), r - l);
+   }
+
+   /// Find the first type, that isn't ordered before the given one           
+   ///   @param list - the sorted list to search in                           
+   ///   @param type - the type to search for                                 
+   ///   @return the position of the type, or where it should be inserted     
+   LANGULUS(INLINED)
+   auto AbleList::LowerBound(const List& list, DMeta type) noexcept {
+      return ::std::lower_bound(list.begin(), list.end(), type,
+         [](const DMeta& lhs, const DMeta& rhs) {
+            return ::std::less<const MetaData*> {}(
+               lhs.operator -> (), rhs.operator -> ());
+         });
+   }
+
+   /// Replace the published list                                             
+   ///   @param list - the modified copy to publish                           
+   ///   @param reclaimer - where to retire the replaced list, if shared      
+   LANGULUS(INLINED)
+   void AbleList::Publish(::std::unique_ptr<const List> list, Reclaimer* reclaimer) {
+      const auto replaced = mList.exchange(list.release(), ::std::memory_order_acq_rel);
+      if (reclaimer)
+         reclaimer->Retire(replaced);
+      else if (replaced)
+         mReplaced.emplace_back(replaced);
+   }
+
+   /// Get the latest published list                                          
+   ///   @attention the list is deleted once it is replaced, and no reader    
+   ///      can see it - stay inside a read section of the reclaimer it's     
+   ///      retired in, while using it                                        
+   ///   @return the sorted list of capable types                             
+   LANGULUS(INLINED)
+   const AbleList::List& AbleList::load() const noexcept {
+      static const List none;
+      const auto list = mList.load(::std::memory_order_acquire);
+      return list ? *list : none;
+   }
+
+   /// Check if a type is capable of doing the verb                           
+   ///   @param type - the type to check                                      
+   ///   @return true if the exact definition is in the set                   
+   LANGULUS(INLINED)
+   bool AbleList::contains(DMeta type) const noexcept {
+      const auto& list = load();
+      const auto found = LowerBound(list, type);
+      return found != list.end()
+         and found->operator -> () == type.operator -> ();
+   }
+
+   /// Insert a type, if it isn't already in the set                          
+   ///   @attention assumes writers are serialized, unless there's no         
+   ///      reclaimer, in which case they're serialized here                  
+   ///   @param type - the type to insert                                     
+   ///   @param reclaimer - where to retire the replaced list, if shared      
+   ///   @return true if the type was inserted                                
+   LANGULUS(INLINED)
+   bool AbleList::insert(DMeta type, Reclaimer* reclaimer) {
+      static ::std::mutex mutex;
+      ::std::unique_lock<::std::mutex> lock;
+      if (not reclaimer)
+         lock = ::std::unique_lock {mutex};
+
+      const auto& list = load();
+      const auto found = LowerBound(list, type);
+      if (found != list.end() and found->operator -> () == type.operator -> ())
+         return false;
+
+      auto copy = ::std::make_unique<List>();
+      copy->reserve(list.size() + 1);
+      copy->insert(copy->end(), list.begin(), found);
+      copy->push_back(type);
+      copy->insert(copy->end(), found, list.end());
+      Publish(::std::move(copy), reclaimer);
+      return true;
+   }
+
+   /// Erase a type from the set                                              
+   ///   @attention assumes writers are serialized                            
+   ///   @param type - the type to erase                                      
+   ///   @param reclaimer - where to retire the replaced list                 
+   ///   @return the number of erased types                                   
+   LANGULUS(INLINED)
+   Count AbleList::erase(DMeta type, Reclaimer* reclaimer) {
+      const auto& list = load();
+      const auto found = LowerBound(list, type);
+      if (found == list.end() or found->operator -> () != type.operator -> ())
+         return 0;
+
+      auto copy = ::std::make_unique<List>();
+      copy->reserve(list.size() - 1);
+      copy->insert(copy->end(), list.begin(), found);
+      copy->insert(copy->end(), found + 1, list.end());
+      Publish(::std::move(copy), reclaimer);
+      return 1;
    }
 
    /// Get the reflected positive token for a verb                            
@@ -157,13 +253,22 @@ namespace Langulus::RTTI
       constexpr auto opNeg = GetReflectedNegativeVerbOperator<T>();
 
       #if LANGULUS_FEATURE(MANAGED_REFLECTION)
+         // Each thread keeps a cached pointer to the definition, but   
+         // it is valid only for the registry epoch it was retrieved    
+         // in, because the library that defined it might be reloaded,  
+         // and thus produce new pointer.                               
+         static thread_local RTTI::MetaCache<VMeta> cache;
+         const auto epoch = Instance.GetEpoch();
+         if (cache.mEpoch == epoch)
+            return cache.mMeta;
+
          // Try to get the definition, type might have been reflected   
-         // previously in another library. Unfortunately we can't keep  
-         // a static pointer to the meta, because forementioned library 
-         // might be reloaded, and thus produce new pointer.            
+         // previously in another library                               
          VMeta meta = Instance.GetMetaVerb(verbPos, RTTI::Boundary);
-         if (meta)
+         if (meta) {
+            cache = {meta, epoch};
             return meta;
+         }
       #else
          // Keep a static meta pointer for each translation unit        
          static constinit ::std::unique_ptr<MetaVerb> meta;
@@ -180,6 +285,7 @@ namespace Langulus::RTTI
             verbPos, verbNeg, opPos, opNeg,
             RTTI::Boundary
          );
+         cache = {meta, epoch};
          auto& generated = const_cast<MetaVerb&>(*meta);
       #else
          meta = ::std::make_unique<MetaVerb>(
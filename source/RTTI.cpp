@@ -26,84 +26,135 @@ namespace Langulus::RTTI
 
    Registry Instance {};
 
-   /// Database destruction                                                   
-   Registry::~Registry() {
-      // If an exception happens here on a delete, then a meta likely   
-      // wasn't unregistered upon mod unload. Thank me later            
-      for (auto& pair : mMetaData)
-         for(auto& meta : pair.second)
-            delete meta.second.mMeta;
-
-      for (auto& pair : mMetaTraits)
-         for (auto& meta : pair.second)
-            delete meta.second.mMeta;
-
-      for (auto& pair : mUniqueVerbs)
-         for (auto& meta : pair.second)
-            delete meta.second.mMeta;
+   ///                                                                        
+   ///   Serializes registrations and unloads, and deletes whatever they      
+   /// retired when done, if no lookup can still see it                       
+   ///                                                                        
+   class Registry::Transaction {
+      Registry& mRegistry;
+      ::std::unique_lock<::std::mutex> mLock;
+
+   public:
+      explicit Transaction(Registry& registry)
+         : mRegistry {registry}
+         , mLock {registry.mMutex} {}
+
+      ~Transaction() {
+         mRegistry.mReclaimer.Collect();
+      }
+   };
+
+   /// Database construction                                                  
+   Registry::Registry() {
+      mBoundaries.insert({ToLowercase(MainBoundary), MainBoundaryID});
+   }
+
+   /// Destroy all definitions of a boundary                                  
+   Registry::Ownership::~Ownership() {
+      // If an exception happens here on a destruction, then a meta     
+      // likely wasn't unregistered upon mod unload. Thank me later     
+      for (auto& meta : mConstants)
+         MetaArena::Destroy(meta);
+      for (auto& meta : mData)
+         MetaArena::Destroy(meta);
+      for (auto& meta : mTraits)
+         MetaArena::Destroy(meta);
+      for (auto& meta : mVerbs)
+         MetaArena::Destroy(meta.second);
+   }
+
+   /// Get the identifier of an interned boundary                             
+   ///   @attention assumes a read section, or a transaction                  
+   ///   @param boundary - the boundary name, or empty to search in any       
+   ///   @return the identifier, AnyBoundaryID if boundary is empty, or       
+   ///      NoBoundaryID if such boundary was never interned                  
+   BoundaryID Registry::FindBoundary(const Token& boundary) const noexcept {
+      if (boundary.empty())
+         return AnyBoundaryID;
+
+      const auto found = mBoundaries.find(boundary);
+      return found ? *found : NoBoundaryID;
+   }
+
+   /// Intern a boundary, if it isn't interned yet                            
+   ///   @attention assumes a transaction                                     
+   ///   @param boundary - the boundary name                                  
+   ///   @return the identifier of the boundary                               
+   BoundaryID Registry::InternBoundary(const Token& boundary) {
+      LANGULUS_ASSUME(DevAssumes, not boundary.empty(), "Bad boundary");
+      const auto found = FindBoundary(boundary);
+      if (found != NoBoundaryID)
+         return found;
+
+      const auto id = static_cast<BoundaryID>(mOwnership.size());
+      mOwnership.emplace_back();
+      mBoundaries.insert({ToLowercase(boundary), id});
+      return id;
    }
 
    /// Common way to extract something from the registry                      
+   ///   @attention assumes a read section, or a transaction                  
    ///   @param where - where to search in                                    
    ///   @param token - the token to search for                               
-   ///   @param boundary - the boundary to search in (optional)               
+   ///   @param boundary - the boundary to search in, or AnyBoundaryID        
    ///   @return the found element, or nullptr if not found                   
    auto Registry::GetMeta(
-      const auto& where, const Token& token, const Token& boundary
+      const auto& where, const Token& token, BoundaryID boundary
    ) const noexcept {
-      using R = decltype(where.begin()->second.begin()->second);
-      const auto lc = ToLowercase(token);
-      const auto foundToken = where.find(lc);
-      if (foundToken == where.end())
+      using R = decltype(where.find(token)->begin()->second);
+      const auto bounded = where.find(token);
+      if (not bounded)
          return (R) nullptr;
 
-      if (not boundary.empty()) {
+      if (boundary != AnyBoundaryID) {
          // Search in a specific boundary                               
-         const auto foundBoundary = foundToken->second.find(boundary);
-         if (foundBoundary == foundToken->second.end())
+         const auto foundBoundary = bounded->find(boundary);
+         if (foundBoundary == bounded->end())
             return (R) nullptr;
          return foundBoundary->second;
       }
       else {
          // Always prefer the main boundary if available, because it's  
          // more persistent                                             
-         const auto foundBoundary = foundToken->second.find(RTTI::MainBoundary);
-         if (foundBoundary != foundToken->second.end())
+         const auto foundBoundary = bounded->find(MainBoundaryID);
+         if (foundBoundary != bounded->end())
             return foundBoundary->second;
-         else if (not foundToken->second.empty())
-            return foundToken->second.begin()->second;
+         else if (not bounded->empty())
+            return bounded->begin()->second;
          return (R) nullptr;
       }
    }
 
    /// Get a list of all the interpretations for an ambiguous token           
    /// These can be data types, verbs, traits, or constants                   
+   ///   @attention assumes a read section, or a transaction, and the list    
+   ///      is valid only inside it                                           
    ///   @param token - the token to search for                               
-   ///   @param boundary - the boundary to search in (optional)               
+   ///   @param boundary - the boundary to search in, or AnyBoundaryID        
    ///   @return the list of associated meta definitions                      
-   const MetaList& Registry::GetMetaList(
-      const auto& where, const Token& token, const Token& boundary
+   const auto& Registry::GetMetaList(
+      const auto& where, const Token& token, BoundaryID boundary
    ) const noexcept {
-      static const MetaList fallback {};
-      const auto lc = ToLowercase(ToLastToken(token));
-      const auto foundToken = where.find(lc);
-      if (foundToken == where.end())
+      using R = Decay<decltype(where.find(token)->begin()->second)>;
+      static const R fallback {};
+      const auto bounded = where.find(ToLastToken(token));
+      if (not bounded)
          return fallback;
 
-      if (not boundary.empty()) {
+      if (boundary != AnyBoundaryID) {
          // Search in a specific boundary                               
-         const auto foundBoundary = foundToken->second.find(boundary);
-         if (foundBoundary == foundToken->second.end())
+         const auto foundBoundary = bounded->find(boundary);
+         if (foundBoundary == bounded->end())
             return fallback;
          return foundBoundary->second;
       }
       else {
          // Always prefer the MAIN boundary, because it's persistent    
-         const auto foundBoundary = foundToken->second.find(RTTI::MainBoundary);
-         if (foundBoundary != foundToken->second.end())
+         const auto foundBoundary = bounded->find(MainBoundaryID);
+         if (foundBoundary != bounded->end())
             return foundBoundary->second;
-         else if (not foundToken->second.empty())
-            return foundToken->second.begin()->second;
+         else if (not bounded->empty())
+            return bounded->begin()->second;
          return fallback;
       }
    }
@@ -113,7 +164,8 @@ namespace Langulus::RTTI
    ///   @param boundary - the boundary to search in (optional)               
    ///   @return the definition, or nullptr if not found                      
    DMeta Registry::GetMetaData(const Token& token, const Token& boundary) const noexcept {
-      return GetMeta(mMetaData, token, boundary);
+      const Reclaimer::Section section {mReclaimer};
+      return GetMeta(mMetaData, token, FindBoundary(boundary));
    }
 
    /// Get an existing meta constant definition by its token and boundary     
@@ -121,7 +173,8 @@ namespace Langulus::RTTI
    ///   @param boundary - the boundary to search in (optional)               
    ///   @return the definition, or nullptr if not found                      
    CMeta Registry::GetMetaConstant(const Token& token, const Token& boundary) const noexcept {
-      return GetMeta(mMetaConstants, token, boundary);
+      const Reclaimer::Section section {mReclaimer};
+      return GetMeta(mMetaConstants, token, FindBoundary(boundary));
    }
 
    /// Get an existing meta trait definition by its token and boundary        
@@ -129,7 +182,8 @@ namespace Langulus::RTTI
    ///   @param boundary - the boundary to search in (optional)               
    ///   @return the definition, or nullptr if not found                      
    TMeta Registry::GetMetaTrait(const Token& token, const Token& boundary) const noexcept {
-      return GetMeta(mMetaTraits, token, boundary);
+      const Reclaimer::Section section {mReclaimer};
+      return GetMeta(mMetaTraits, token, FindBoundary(boundary));
    }
 
    /// Get an existing meta verb definition by its token and boundary         
@@ -138,7 +192,8 @@ namespace Langulus::RTTI
    ///   @param boundary - the boundary to search in (optional)               
    ///   @return the definition, or nullptr if not found                      
    VMeta Registry::GetMetaVerb(const Token& token, const Token& boundary) const noexcept {
-      return GetMeta(mMetaVerbs, token, boundary);
+      const Reclaimer::Section section {mReclaimer};
+      return GetMeta(mMetaVerbs, token, FindBoundary(boundary));
    }
 
    /// Get an existing meta verb definition by its operator token and boundary
@@ -147,55 +202,35 @@ namespace Langulus::RTTI
    ///   @param boundary - the boundary to search in (optional)               
    ///   @return the definition, or nullptr if not found                      
    VMeta Registry::GetOperator(const Token& token, const Token& boundary) const noexcept {
-      const auto lc = IsolateOperator(token);
-      return GetMeta(mOperators, lc, boundary);
+      const auto op = IsolateOperator(token);
+      const Reclaimer::Section section {mReclaimer};
+      return GetMeta(mOperators, op, FindBoundary(boundary));
    }
 
    /// Get a list of all the interpretations for an ambiguous token           
    /// These can be data types, verbs, traits, or constants                   
    ///   @param token - the token to search for                               
    ///   @param boundary - the boundary to search in (optional)               
-   ///   @return the list of associated meta definitions                      
-   const MetaList& Registry::GetAmbiguousMeta(
+   ///   @return a copy of the list of associated meta definitions            
+   MetaList Registry::GetAmbiguousMeta(
       const Token& token, const Token& boundary
-   ) const noexcept {
-      return GetMetaList(mMetaAmbiguous, token, boundary);
+   ) const {
+      const Reclaimer::Section section {mReclaimer};
+      return GetMetaList(mMetaAmbiguous, token, FindBoundary(boundary));
    }
    
-   /// Disambiguate a token                                                   
-   /// Works in the following way:                                            
-   ///   1. Checks keyword for an exact match (not case-sensitive)            
-   ///      If such is found, the meta is returned directly                   
-   ///   2. If multiple keywords match partially:                             
-   ///      a. Meta-data and meta-traits are always with higher priority than 
-   ///         meta-verbs and meta-constants.                                 
-   ///      b. A keyword starting with a capital letter is always hinted as   
-   ///         meta-data, instead of meta-trait.                              
-   ///   3. If after all these disambiguation attempts there's still ambiguity
-   ///      throw a Meta exception - the ambiguity has to be manually fixed   
-   ///   @param keyword - the token to search for                             
-   ///   @param boundary - the boundary to search in (optional)               
-   ///   @return the disambiguated token; throws if not found/ambiguous       
-   AMeta Registry::DisambiguateMeta(const Token& keyword, const Token& boundary) const {
-      auto& symbols = GetAmbiguousMeta(keyword, boundary);
-      LANGULUS_ASSERT(not symbols.empty(), Meta,
-         "Keyword not found", ": `", keyword, '`');
-      if (symbols.size() == 1) {
-         // No ambiguity, just return the single result (1)             
-         return *symbols.begin();
-      }
-
-      // Collect all origin types, and work with those                  
-      // Also, GetAmbiguousMeta works only with the last part of the    
-      // keyword, but the keyword might contain hints as to which       
-      // ambiguous meta to pick. Discard symbols that do not            
-      // contain the provided keyword (not case sensitive)              
-      const auto lowercased = ToLowercase(keyword);
+   /// Collect the origins of all symbols, that contain the keyword           
+   /// GetAmbiguousMeta works only with the last part of the keyword, but the 
+   /// keyword might contain hints as to which ambiguous meta to pick, so     
+   /// symbols that do not contain the provided keyword are discarded         
+   ///   @param symbols - the symbols sharing the keyword's last token        
+   ///   @param keyword - the keyword (not case sensitive)                    
+   ///   @return the relevant origins                                         
+   static MetaList CollectOrigins(const MetaList& symbols, const Token& keyword) {
       MetaList origins;
       for (auto& meta : symbols) {
          LANGULUS_ASSUME(DevAssumes, meta, "Bad meta");
-         const auto meta_lc_token = ToLowercase(meta->mToken);
-         if (meta_lc_token.find(lowercased) == std::string::npos)
+         if (not ContainsCaseInsensitive(meta->mToken, keyword))
             continue;
 
          const auto dmeta = meta.As<DMeta>();
@@ -207,9 +242,43 @@ namespace Langulus::RTTI
          }
          else origins.insert(meta);
       }
+      return origins;
+   }
 
-      LANGULUS_ASSERT(not origins.empty(), Meta,
-         "No relevant origins for keyword", ": `", keyword, '`');
+   /// Check if all data symbols have finished reflecting                     
+   /// Symbols are grouped by their origins, which are assigned only after    
+   /// the symbols are registered, so anything deduced from them before       
+   /// reflection finishes might change, and must not be remembered           
+   ///   @param symbols - the symbols to check                                
+   ///   @return true if all data symbols have finished reflecting            
+   static bool Reflected(const MetaList& symbols) noexcept {
+      for (auto& meta : symbols) {
+         const auto dmeta = meta.As<DMeta>();
+         if (dmeta and not dmeta->mIsReflected)
+            return false;
+      }
+      return true;
+   }
+
+   /// Disambiguate a keyword among a list of symbols                         
+   ///   @param symbols - the symbols sharing the keyword's last token        
+   ///   @param keyword - the keyword (not case sensitive)                    
+   ///   @param capital - whether keyword starts with a capital letter        
+   ///   @return the disambiguated meta, or nullptr if not found/ambiguous    
+   static AMeta Disambiguate(
+      const MetaList& symbols, const Token& keyword, bool capital
+   ) {
+      if (symbols.empty())
+         return {};
+      if (symbols.size() == 1) {
+         // No ambiguity, just return the single result (1)             
+         return *symbols.begin();
+      }
+
+      // Collect all origin types, and work with those                  
+      const auto origins = CollectOrigins(symbols, keyword);
+      if (origins.empty())
+         return {};
 
       DMeta meta_data;
       DMeta meta_data_exact_match;
@@ -223,15 +292,15 @@ namespace Langulus::RTTI
       }
       else for (auto& candidate : origins) {
          // There's a chance, that one of the symbols matches the       
-         // lowercased keyword exactly (1)                              
-         if (ToLowercase(candidate->mToken) == lowercased)
+         // keyword exactly, ignoring case (1)                          
+         if (CaseInsensitiveEqual {}(candidate->mToken, keyword))
             meta_data_exact_match = candidate;
 
-         if (candidate.Kind() == Meta::Data) {
+         if (candidate->mKind == MetaKind::Data) {
             meta_data = candidate;
             ++meta_data_encountered;
          }
-         else if (candidate.Kind() == Meta::Trait) {
+         else if (candidate->mKind == MetaKind::Trait) {
             meta_trait = candidate;
             ++meta_trait_encountered;
          }
@@ -240,7 +309,7 @@ namespace Langulus::RTTI
       // If there are data/traits available, discard verbs/consts (2.a) 
       if (meta_data_encountered and meta_trait_encountered) {
          // Both data and traits encountered, check first letter (2.b)  
-         if (::std::islower(keyword[0])) {
+         if (not capital) {
             if (meta_trait_encountered == 1)
                return meta_trait;
          }
@@ -266,6 +335,62 @@ namespace Langulus::RTTI
          return meta_trait;
       }
 
+      // Unfixable ambiguity                                            
+      return {};
+   }
+
+   /// Disambiguate a token                                                   
+   /// Works in the following way:                                            
+   ///   1. Checks keyword for an exact match (not case-sensitive)            
+   ///      If such is found, the meta is returned directly                   
+   ///   2. If multiple keywords match partially:                             
+   ///      a. Meta-data and meta-traits are always with higher priority than 
+   ///         meta-verbs and meta-constants.                                 
+   ///      b. A keyword starting with a capital letter is always hinted as   
+   ///         meta-data, instead of meta-trait.                              
+   ///   3. If after all these disambiguation attempts there's still ambiguity
+   ///      throw a Meta exception - the ambiguity has to be manually fixed   
+   /// Symbols are indexed by their last token, and a keyword that is just a  
+   /// last token resolves the same way until a symbol sharing it is          
+   /// registered or unregistered, so that resolution is remembered next to   
+   /// the symbols, and resolving again is a single lookup, that doesn't      
+   /// allocate. Qualified keywords, keywords that failed to resolve, or that 
+   /// were resolved while some symbols were still reflecting, are never      
+   /// remembered                                                             
+   ///   @param keyword - the token to search for                             
+   ///   @param boundary - the boundary to search in (optional)               
+   ///   @return the disambiguated token; throws if not found/ambiguous       
+   AMeta Registry::DisambiguateMeta(const Token& keyword, const Token& boundary) const {
+      const bool capital = not keyword.empty() and not ::std::islower(keyword[0]);
+      const Reclaimer::Section section {mReclaimer};
+      auto& symbols = GetMetaList(mMetaAmbiguous, keyword, FindBoundary(boundary));
+      LANGULUS_ASSERT(not symbols.empty(), Meta,
+         "Keyword not found", ": `", keyword, '`');
+
+      // Symbols contain their last token, so if the keyword is just    
+      // that, it doesn't hint at anything, and resolves the same way   
+      // for as long as the symbols stay the same                       
+      const bool unqualified = ToLastToken(keyword).size() == keyword.size();
+      auto& remembered = capital ? symbols.mCapital : symbols.mLower;
+      if (unqualified) {
+         const auto meta = remembered.load(::std::memory_order_acquire);
+         if (meta)
+            return meta;
+      }
+
+      const auto meta = Disambiguate(symbols, keyword, capital);
+      if (meta) {
+         // Remember the resolution for next time, unless the origins   
+         // of some symbols are still unknown, and might change it      
+         if (unqualified and Reflected(symbols))
+            remembered.store(meta.mMeta, ::std::memory_order_release);
+         return meta;
+      }
+
+      const auto origins = CollectOrigins(symbols, keyword);
+      LANGULUS_ASSERT(not origins.empty(), Meta,
+         "No relevant origins for keyword", ": `", keyword, '`');
+
       // Unfixable ambiguity reached, report error and throw (3)        
       const auto tab = Logger::ErrorTab(
          "Ambiguous symbol: `", keyword, "`; Could be one of: "
@@ -280,55 +405,86 @@ namespace Langulus::RTTI
    /// Resolve a file extension                                               
    ///   @param token - the file extension to search for                      
    ///   @param boundary - the boundary to search in (optional)               
-   ///   @return all meta definitions associated with the file extension      
-   const MetaList& Registry::ResolveFileExtension(
+   ///   @return a copy of all meta definitions associated with the extension 
+   MetaList Registry::ResolveFileExtension(
       const Token& token, const Token& boundary
    ) const {
-      return GetMetaList(mFileDatabase, token, boundary);
+      const Reclaimer::Section section {mReclaimer};
+      return GetMetaList(mFileDatabase, token, FindBoundary(boundary));
    }
    
+   /// Get the dense index of an origin data type                             
+   /// Indices are assigned by token on first request, and are never reused,  
+   /// so a type has the same index in every boundary, even after reloading   
+   ///   @param token - the token of the origin type                          
+   ///   @return the index                                                    
+   ::std::uint32_t Registry::GetDataIndex(const Token& token) {
+      const Transaction transaction {*this};
+      const auto next = static_cast<::std::uint32_t>(mDataIndices.size());
+      return *mDataIndices.insert({ToLowercase(token), next}).first;
+   }
+
    /// Register most relevant token to the ambiguous token map                
+   ///   @attention assumes a transaction                                     
    ///   @param boundary - the boundary to register in                        
    ///   @param token - the token to register                                 
    ///   @param meta - the definition to add                                  
    void Registry::RegisterAmbiguous(
-      const Token& boundary, const Lowercase& token, AMeta meta
-   ) noexcept {
-      Lowercase ambiguous {ToLastToken(token)};
-      const auto foundAmbiguous = mMetaAmbiguous.find(ambiguous);
-      if (foundAmbiguous == mMetaAmbiguous.end()) {
-         mMetaAmbiguous.insert({std::move(ambiguous), {{boundary, {meta}}}});
-         return;
-      }
-
-      const auto foundBoundary = foundAmbiguous->second.find(boundary);
-      if (foundBoundary == foundAmbiguous->second.end())
-         foundAmbiguous->second.insert({boundary, {meta}});
-      else
-         foundBoundary->second.insert(meta);
+      BoundaryID boundary, const Lowercase& token, AMeta meta
+   ) {
+      const auto last = ToLastToken(token);
+      mMetaAmbiguous.update(last, [&](BoundedMeta<Symbols>& bounded) {
+         const auto foundBoundary = bounded.find(boundary);
+         if (foundBoundary == bounded.end())
+            bounded.insert({boundary, {meta}});
+         else
+            foundBoundary->second.insert(meta);
+      });
+
+      mAmbiguity.fetch_add(1);
+      ResetShortestTokens(last);
    }
 
    /// Unregister most relevant token from the ambiguous token map            
+   ///   @attention assumes a transaction                                     
    ///   @attention only definitions in current boundary are affected         
    ///   @param boundary - the boundary to unregister from                    
    ///   @param token - the token to unregister                               
    ///   @param meta - the definition to remove                               
    void Registry::UnregisterAmbiguous(
-      const Token& boundary, const Lowercase& token, AMeta meta
-   ) noexcept {
-      Lowercase ambiguous {ToLastToken(token)};
-      const auto foundAmbiguous = mMetaAmbiguous.find(ambiguous);
-      if (foundAmbiguous == mMetaAmbiguous.end())
-         return;
-      const auto foundBoundary = foundAmbiguous->second.find(boundary);
-      if (foundBoundary == foundAmbiguous->second.end())
+      BoundaryID boundary, const Token& token, AMeta meta
+   ) {
+      const auto last = ToLastToken(token);
+      mMetaAmbiguous.update(last, [&](BoundedMeta<Symbols>& bounded) {
+         const auto foundBoundary = bounded.find(boundary);
+         if (foundBoundary == bounded.end())
+            return;
+
+         foundBoundary->second.erase(meta);
+         if (foundBoundary->second.empty())
+            bounded.erase(foundBoundary);
+      });
+
+      mAmbiguity.fetch_add(1);
+      ResetShortestTokens(last);
+   }
+
+   /// Invalidate the cached shortest tokens of all definitions, that share   
+   /// the same last token, because the set of such definitions changed       
+   ///   @attention assumes a transaction, and that the ambiguity map has     
+   ///      been modified, and mAmbiguity bumped, before calling this         
+   ///   @param last - the last token of the added/removed definition         
+   void Registry::ResetShortestTokens(const Token& last) noexcept {
+      const auto bounded = mMetaAmbiguous.find(last);
+      if (not bounded)
          return;
 
-      foundBoundary->second.erase(meta);
-      if (foundBoundary->second.empty())
-         foundAmbiguous->second.erase(foundBoundary);
-      if (foundAmbiguous->second.empty())
-         mMetaAmbiguous.erase(foundAmbiguous);
+      for (auto& list : *bounded) {
+         for (auto& meta : list.second) {
+            ::std::atomic_ref<uint32_t> {meta->mShortestToken}
+               .store(Meta::ShortestTokenNotCached);
+         }
+      }
    }
 
    /// A common function to register a specific type in a specific place      
@@ -341,16 +497,14 @@ namespace Langulus::RTTI
    ///   @return the newly defined meta for that token                        
    template<bool REGISTER_AMBIGUOUS>
    auto Registry::Register(
-      auto meta, auto& where, const Lowercase& lc, const Token& boundary
+      auto meta, auto& where, const Lowercase& lc, BoundaryID boundary
    ) IF_UNSAFE(noexcept) {
-      LANGULUS_ASSUME(DevAssumes, not boundary.empty(), "Bad boundary");
+      LANGULUS_ASSUME(DevAssumes, boundary < mOwnership.size(), "Bad boundary");
 
       // If reached, then not found, so insert a new definition         
-      const auto foundToken = where.find(lc);
-      if (foundToken == where.end())
-         where.insert({lc, {{boundary, meta}}});
-      else
-         foundToken->second.insert({boundary, meta});
+      where.update(lc, [&](auto& bounded) {
+         bounded.insert({boundary, meta});
+      });
 
       // Insert the last token to the ambiguity map                     
       if constexpr (REGISTER_AMBIGUOUS)
@@ -367,17 +521,28 @@ namespace Langulus::RTTI
       const Token& token, const Token& boundary
    ) {
       auto lc = ToLowercase(token);
-      LANGULUS_ASSUME(DevAssumes, not GetMetaData(lc, boundary),
+      const Transaction transaction {*this};
+      const auto id = InternBoundary(boundary);
+      LANGULUS_ASSUME(DevAssumes, not GetMeta(mMetaData, lc, id),
          "Data with this name is already registered: ", token);
 
-      LANGULUS_ASSERT(not GetMetaTrait(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaTraits, lc, AnyBoundaryID), Meta,
          "Data name conflicts with trait: ", token);
-      LANGULUS_ASSERT(not GetMetaVerb(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaVerbs, lc, AnyBoundaryID), Meta,
          "Data name conflicts with verb: ", token);
-      LANGULUS_ASSERT(not GetMetaConstant(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaConstants, lc, AnyBoundaryID), Meta,
          "Data name conflicts with constant: ", token);
 
-      return Register(new MetaData {token}, mMetaData, lc, boundary);
+      // The same type might already be registered in another boundary, 
+      // so refer to it before lookups can find the new definition      
+      const auto canonical = GetMeta(mMetaData, lc, AnyBoundaryID);
+      const auto definition = mOwnership[id].mArena.New<MetaData>(token);
+      if (canonical)
+         definition->mCanonical = canonical->GetCanonical();
+
+      const auto meta = Register(definition, mMetaData, lc, id);
+      mOwnership[id].mData.emplace_back(meta);
+      return meta;
    }
 
    /// Register a constant definition                                         
@@ -389,17 +554,22 @@ namespace Langulus::RTTI
       const Token& token, const Token& boundary
    ) {
       auto lc = ToLowercase(token);
-      LANGULUS_ASSUME(DevAssumes, not GetMetaConstant(lc, boundary),
+      const Transaction transaction {*this};
+      const auto id = InternBoundary(boundary);
+      LANGULUS_ASSUME(DevAssumes, not GetMeta(mMetaConstants, lc, id),
          "Constant with this name is already registered: ", token);
 
-      LANGULUS_ASSERT(not GetMetaTrait(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaTraits, lc, AnyBoundaryID), Meta,
          "Constant name conflicts with trait: ", token);
-      LANGULUS_ASSERT(not GetMetaVerb(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaVerbs, lc, AnyBoundaryID), Meta,
          "Constant name conflicts with verb: ", token);
-      LANGULUS_ASSERT(not GetMetaData(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaData, lc, AnyBoundaryID), Meta,
          "Constant name conflicts with data: ", token);
 
-      return Register(new MetaConst {token}, mMetaConstants, lc, boundary);
+      const auto meta = Register(
+         mOwnership[id].mArena.New<MetaConst>(token), mMetaConstants, lc, id);
+      mOwnership[id].mConstants.emplace_back(meta);
+      return meta;
    }
 
    /// Register a trait definition                                            
@@ -411,17 +581,22 @@ namespace Langulus::RTTI
       const Token& token, const Token& boundary
    ) {
       auto lc = ToLowercase(token);
-      LANGULUS_ASSUME(DevAssumes, not GetMetaTrait(lc, boundary),
+      const Transaction transaction {*this};
+      const auto id = InternBoundary(boundary);
+      LANGULUS_ASSUME(DevAssumes, not GetMeta(mMetaTraits, lc, id),
          "Trait with this name is already registered: ", token);
 
-      LANGULUS_ASSERT(not GetMetaConstant(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaConstants, lc, AnyBoundaryID), Meta,
          "Trait name conflicts with constant: ", token);
-      LANGULUS_ASSERT(not GetMetaVerb(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaVerbs, lc, AnyBoundaryID), Meta,
          "Trait name conflicts with verb: ", token);
-      LANGULUS_ASSERT(not GetMetaData(lc), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaData, lc, AnyBoundaryID), Meta,
          "Trait name conflicts with data: ", token);
 
-      return Register(new MetaTrait {token}, mMetaTraits, lc, boundary);
+      const auto meta = Register(
+         mOwnership[id].mArena.New<MetaTrait>(token), mMetaTraits, lc, id);
+      mOwnership[id].mTraits.emplace_back(meta);
+      return meta;
    }
 
    /// Register a verb definition                                             
@@ -444,79 +619,82 @@ namespace Langulus::RTTI
       LANGULUS_ASSUME(DevAssumes, not boundary.empty(),
          "Bad boundary provided");
       const auto cppnamelc = ToLowercase(cppname);
+      const Transaction transaction {*this};
+      const auto id = InternBoundary(boundary);
 
       IF_SAFE(const auto uniqueFound = mUniqueVerbs.find(cppnamelc));
-      LANGULUS_ASSUME(DevAssumes, uniqueFound == mUniqueVerbs.end()
-         or uniqueFound->second.find(boundary) == uniqueFound->second.end(),
+      LANGULUS_ASSUME(DevAssumes, not uniqueFound
+         or uniqueFound->find(id) == uniqueFound->end(),
          "Verb already registered for that boundary");
 
       auto lc1 = ToLowercase(token);
       auto lc2 = ToLowercase(tokenReverse);
-      LANGULUS_ASSUME(DevAssumes, not GetMetaVerb(lc1, boundary)
-                              and not GetMetaVerb(lc2, boundary),
+      LANGULUS_ASSUME(DevAssumes, not GetMeta(mMetaVerbs, lc1, id)
+                              and not GetMeta(mMetaVerbs, lc2, id),
          "Verb already registered with one of the following tokens: ",
          token, ", ", tokenReverse
       );
 
-      LANGULUS_ASSERT(not GetMetaConstant(token), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaConstants, token, AnyBoundaryID), Meta,
          "Verb positive token conflicts with constant: ", token);
-      LANGULUS_ASSERT(not GetMetaTrait(token), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaTraits, token, AnyBoundaryID), Meta,
          "Verb positive token conflicts with trait: ", token);
-      LANGULUS_ASSERT(not GetMetaData(token), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaData, token, AnyBoundaryID), Meta,
          "Verb positive token conflicts with data: ", token);
 
-      LANGULUS_ASSERT(not GetMetaConstant(tokenReverse), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaConstants, tokenReverse, AnyBoundaryID), Meta,
          "Verb negative token conflicts with constant: ", tokenReverse);
-      LANGULUS_ASSERT(not GetMetaTrait(tokenReverse), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaTraits, tokenReverse, AnyBoundaryID), Meta,
          "Verb negative token conflicts with trait: ", tokenReverse);
-      LANGULUS_ASSERT(not GetMetaData(tokenReverse), Meta,
+      LANGULUS_ASSERT(not GetMeta(mMetaData, tokenReverse, AnyBoundaryID), Meta,
          "Verb negative token conflicts with data: ", tokenReverse);
 
       Lowercase op1;
       if (not op.empty()) {
-         op1 = IsolateOperator(op);
-         LANGULUS_ASSUME(DevAssumes, not GetOperator(op1, boundary),
+         op1 = ToLowercase(IsolateOperator(op));
+         LANGULUS_ASSUME(DevAssumes, not GetMeta(mOperators, op1, id),
             "Positive operator already registered");
 
-         LANGULUS_ASSERT(not GetMetaConstant(op1), Meta,
+         LANGULUS_ASSERT(not GetMeta(mMetaConstants, op1, AnyBoundaryID), Meta,
             "Verb positive operator conflicts with constant: ", op1);
-         LANGULUS_ASSERT(not GetMetaTrait(op1), Meta,
+         LANGULUS_ASSERT(not GetMeta(mMetaTraits, op1, AnyBoundaryID), Meta,
             "Verb positive operator conflicts with trait: ", op1);
-         LANGULUS_ASSERT(not GetMetaData(op1), Meta,
+         LANGULUS_ASSERT(not GetMeta(mMetaData, op1, AnyBoundaryID), Meta,
             "Verb positive operator conflicts with data: ", op1);
       }
 
       Lowercase op2;
       if (not opReverse.empty()) {
-         op2 = IsolateOperator(opReverse);
-         LANGULUS_ASSUME(DevAssumes, not GetOperator(op2, boundary),
+         op2 = ToLowercase(IsolateOperator(opReverse));
+         LANGULUS_ASSUME(DevAssumes, not GetMeta(mOperators, op2, id),
             "Negative operator already registered");
 
-         LANGULUS_ASSERT(not GetMetaConstant(op2), Meta,
+         LANGULUS_ASSERT(not GetMeta(mMetaConstants, op2, AnyBoundaryID), Meta,
             "Verb positive operator conflicts with constant: ", op2);
-         LANGULUS_ASSERT(not GetMetaTrait(op2), Meta,
+         LANGULUS_ASSERT(not GetMeta(mMetaTraits, op2, AnyBoundaryID), Meta,
             "Verb positive operator conflicts with trait: ", op2);
-         LANGULUS_ASSERT(not GetMetaData(op2), Meta,
+         LANGULUS_ASSERT(not GetMeta(mMetaData, op2, AnyBoundaryID), Meta,
             "Verb positive operator conflicts with data: ", op2);
       }
 
       const auto meta = Register<false>(
-         new MetaVerb {token, tokenReverse, op, opReverse},
-         mUniqueVerbs, cppnamelc, boundary
+         mOwnership[id].mArena.New<MetaVerb>(token, tokenReverse, op, opReverse),
+         mUniqueVerbs, cppnamelc, id
       );
+      mOwnership[id].mVerbs.emplace_back(cppnamelc, meta);
       VERBOSE("Verb ", token, "/", tokenReverse, " registered");
 
-      Register(meta, mMetaVerbs, lc1, boundary);
+      Register(meta, mMetaVerbs, lc1, id);
       if (lc1 != lc2)
-         Register(meta, mMetaVerbs, lc2, boundary);
+         Register(meta, mMetaVerbs, lc2, id);
 
       if (not op1.empty()) {
-         Register<false>(meta, mOperators, op1, boundary);
+         Register<false>(meta, mOperators, op1, id);
          VERBOSE("Operator ", op1, " registered");
       }
 
       if (not op2.empty() and op1 != op2) {
-         Register<false>(meta, mOperators, op2, boundary);
+         Register<false>(meta, mOperators, op2, id);
          VERBOSE("Operator ", op1, " registered");
       }
 
@@ -537,132 +715,152 @@ namespace Langulus::RTTI
       LANGULUS_ASSUME(DevAssumes, not boundary.empty(),
          "Bad boundary provided");
 
-      const auto lc = ToLowercase(token);
-      const auto foundToken = mFileDatabase.find(lc);
-      if (foundToken == mFileDatabase.end()) {
-         mFileDatabase[lc].insert({boundary, {type.mMeta}});
-         return;
-      }
+      const Transaction transaction {*this};
+      const auto id = InternBoundary(boundary);
+      bool owned = false;
+      mFileDatabase.update(token, [&](BoundedMeta<MetaList>& bounded) {
+         const auto foundBoundary = bounded.find(id);
+         if (foundBoundary == bounded.end()) {
+            bounded.insert({id, {type.mMeta}});
+            owned = true;
+         }
+         else foundBoundary->second.insert(type.mMeta);
+      });
 
-      const auto foundBoundary = foundToken->second.find(boundary);
-      if (foundBoundary == foundToken->second.end())
-         foundToken->second.insert({boundary, {type.mMeta}});
-      else
-         foundBoundary->second.insert(type.mMeta);
+      if (owned)
+         mOwnership[id].mFiles.emplace_back(ToLowercase(token));
    }
 
-   /// Runs through all definitions, and destroys all of those, that were     
-   /// defined within the given boundary token                                
+   /// Index a type in a verb it is capable of                                
+   /// The type is forgotten when its boundary is unloaded                    
+   ///   @param verb - the verb                                               
+   ///   @param type - the capable type                                       
+   void Registry::RegisterAbility(VMeta verb, DMeta type) {
+      LANGULUS_ASSUME(DevAssumes, verb and type,
+         "Bad ability provided");
+
+      const Transaction transaction {*this};
+      const_cast<MetaVerb&>(*verb).mAble.insert(type, &mReclaimer);
+   }
+
+   /// Destroys all definitions, that were defined within the given boundary  
+   /// Only definitions owned by that boundary are visited. Lookups might     
+   /// still be looking at them, so they are destroyed only after all such    
+   /// lookups are done                                                       
    ///   @param boundary - the boundary token to search for                   
    void Registry::UnloadBoundary(const Token& boundary) {
       VERBOSE(Logger::PushRed, Logger::Underline, 
          "Unloading library ", boundary, Logger::Pop);
+      const Transaction transaction {*this};
+      const auto id = FindBoundary(boundary);
+      if (id == NoBoundaryID)
+         return;
 
-      // Unload constants                                               
-      for (auto pair = mMetaConstants.begin(); pair != mMetaConstants.end();) {
-         auto found = pair->second.find(boundary);
-         if (found == pair->second.end()) {
-            ++pair;
-            continue;
-         }
+      // Invalidate all definitions that were cached outside registry   
+      mEpoch.fetch_add(1, ::std::memory_order_release);
+
+      // Only definitions owned by the boundary are visited, and the    
+      // record is left empty, because boundary ids are never recycled  
+      // The definitions and their arena are retired when leaving scope 
+      auto owned = ::std::make_unique<Ownership>(::std::move(mOwnership[id]));
+      mOwnership[id] = {};
+
+      // Remove a definition from a database, and from ambiguity map    
+      const auto unregister = [&](auto& where, AMeta meta) {
+         LANGULUS_ASSUME(DevAssumes, where.find(meta->mToken),
+            "Owned definition is missing from the database");
+         where.update(meta->mToken, [&](auto& bounded) {
+            bounded.erase(id);
+         });
+         UnregisterAmbiguous(id, meta->mToken, meta);
+      };
+
+      // Remove a definition from a database without ambiguity          
+      const auto unregisterUnique = [&](auto& where, const Token& token) {
+         where.update(token, [&](auto& bounded) {
+            bounded.erase(id);
+         });
+      };
 
-         VERBOSE("Constant ", Logger::PushYellow, found->second->mToken,
+      // Unload constants                                               
+      for (auto& definition : owned->mConstants) {
+         VERBOSE("Constant ", Logger::PushYellow, definition->mToken,
             Logger::PopRed, " unregistered (", boundary, ")");
-
-         UnregisterAmbiguous(boundary, pair->first, found->second.mMeta);
-         delete found->second.mMeta;
-         pair->second.erase(found);
-         if (pair->second.empty())
-            pair = mMetaConstants.erase(pair);
-         else ++pair;
+         unregister(mMetaConstants, definition);
       }
 
       // Unload file types                                              
-      for (auto pair = mFileDatabase.begin(); pair != mFileDatabase.end();) {
-         auto found = pair->second.find(boundary);
-         if (found == pair->second.end()) {
-            ++pair;
-            continue;
-         }
-
-         VERBOSE("File ", Logger::PushCyan, pair->first,
+      for (auto& extension : owned->mFiles) {
+         VERBOSE("File ", Logger::PushCyan, extension,
             Logger::PopRed, " unregistered (", boundary, ")");
-
-         pair->second.erase(found);
-         if (pair->second.empty())
-            pair = mFileDatabase.erase(pair);
-         else ++pair;
+         LANGULUS_ASSUME(DevAssumes, mFileDatabase.find(extension),
+            "Owned file extension is missing from the database");
+         unregisterUnique(mFileDatabase, extension);
       }
 
-      // Unload data types                                              
-      for (auto pair = mMetaData.begin(); pair != mMetaData.end();) {
-         auto found = pair->second.find(boundary);
-         if (found == pair->second.end()) {
-            ++pair;
-            continue;
+      // Conversions reflected in unloaded types are also registered    
+      // in the types they convert from, which might survive            
+      for (auto& definition : owned->mData) {
+         for (auto& [from, converter] : definition->mConvertersFrom) {
+            const_cast<MetaData&>(*from).mConversions.update(
+               [&](ConverterMap& conversions) {
+                  conversions.erase(definition);
+               });
          }
+      }
 
-         VERBOSE("Data ", Logger::PushCyan, found->second->mToken,
+      // Unload data types                                              
+      for (auto& definition : owned->mData) {
+         VERBOSE("Data ", Logger::PushCyan, definition->mToken,
             Logger::PopRed, " unregistered (", boundary, ")");
+         unregister(mMetaData, definition);
+
+         // Definitions of the same type in other boundaries might      
+         // refer to this one as canonical, so pick a new one for them  
+         const auto survivors = mMetaData.find(definition->mToken);
+         if (survivors and definition->GetCanonical() == definition.mMeta) {
+            const auto canonical = survivors->begin()->second.mMeta;
+            for (auto& survivor : *survivors) {
+               ::std::atomic_ref<const Meta*> {survivor.second->mCanonical}
+                  .store(canonical, ::std::memory_order_relaxed);
+            }
+         }
 
-         UnregisterAmbiguous(boundary, pair->first, found->second.mMeta);
-         delete found->second.mMeta;
-         pair->second.erase(found);
-         if (pair->second.empty())
-            pair = mMetaData.erase(pair);
-         else ++pair;
+         // Verbs are unloaded last, so the ones this type is capable   
+         // of are still around, and must forget about it               
+         for (auto& [verb, ability] : definition->mAbilities)
+            const_cast<MetaVerb&>(*verb).mAble.erase(definition, &mReclaimer);
       }
 
       // Unload traits                                                  
-      for (auto pair = mMetaTraits.begin(); pair != mMetaTraits.end();) {
-         auto found = pair->second.find(boundary);
-         if (found == pair->second.end()) {
-            ++pair;
-            continue;
-         }
-
-         VERBOSE("Trait ", Logger::PushPurple, found->second->mToken,
+      for (auto& definition : owned->mTraits) {
+         VERBOSE("Trait ", Logger::PushPurple, definition->mToken,
             Logger::PopRed, " unregistered (", boundary, ")");
-
-         UnregisterAmbiguous(boundary, pair->first, found->second.mMeta);
-         delete found->second.mMeta;
-         pair->second.erase(found);
-         if (pair->second.empty())
-            pair = mMetaTraits.erase(pair);
-         else ++pair;
+         unregister(mMetaTraits, definition);
       }
 
       // Unload verbs                                                   
-      for (auto pair = mUniqueVerbs.begin(); pair != mUniqueVerbs.end();) {
-         auto found = pair->second.find(boundary);
-         if (found == pair->second.end()) {
-            ++pair;
-            continue;
-         }
+      for (auto& [cppname, definition] : owned->mVerbs) {
+         LANGULUS_ASSUME(DevAssumes, mUniqueVerbs.find(cppname),
+            "Owned verb is missing from the database");
+         unregisterUnique(mUniqueVerbs, cppname);
 
-         VMeta definition = found->second;
-         const auto lc1 = ToLowercase(definition->mToken);
-         const auto lc2 = ToLowercase(definition->mTokenReverse);
+         const auto token1 = definition->mToken;
+         const auto token2 = definition->mTokenReverse;
          LANGULUS_ASSUME(DevAssumes, definition
-            and definition == GetMetaVerb(lc1, boundary)
-            and definition == GetMetaVerb(lc2, boundary),
+            and definition == GetMeta(mMetaVerbs, token1, id)
+            and definition == GetMeta(mMetaVerbs, token2, id),
             "Bad VMeta definition"
          );
 
-         auto foundlc1 = mMetaVerbs.find(lc1);
-         if (foundlc1 != mMetaVerbs.end())
-            foundlc1->second.erase(boundary);
-         auto foundlc2 = mMetaVerbs.find(lc2);
-         if (foundlc2 != mMetaVerbs.end())
-            foundlc2->second.erase(boundary);
+         unregisterUnique(mMetaVerbs, token1);
+         unregisterUnique(mMetaVerbs, token2);
 
          if (definition->mOperator.size()) {
             const auto op1 = IsolateOperator(definition->mOperator);
             VERBOSE("Operator ", Logger::PushDarkGreen, op1,
                Logger::PopRed, " unregistered (", boundary, ")");
-            auto foundop1 = mOperators.find(op1);
-            if (foundop1 != mOperators.end())
-               foundop1->second.erase(boundary);
+            unregisterUnique(mOperators, op1);
          }
 
          if (definition->mOperatorReverse.size()
@@ -670,9 +868,7 @@ namespace Langulus::RTTI
             const auto op2 = IsolateOperator(definition->mOperatorReverse);
             VERBOSE("Operator ", Logger::PushDarkGreen, op2,
                Logger::PopRed, " unregistered (", boundary, ")");
-            auto foundop2 = mOperators.find(op2);
-            if (foundop2 != mOperators.end())
-               foundop2->second.erase(boundary);
+            unregisterUnique(mOperators, op2);
          }
 
          if (definition->mToken != definition->mTokenReverse) {
@@ -686,89 +882,130 @@ namespace Langulus::RTTI
                " unregistered (", boundary, ")");
          }
 
-         UnregisterAmbiguous(boundary, lc1, definition.mMeta);
-         UnregisterAmbiguous(boundary, lc2, definition.mMeta);
-         pair->second.erase(found);
-         if (pair->second.empty())
-            pair = mUniqueVerbs.erase(pair);
-         else ++pair;
-
-         delete definition.mMeta;
+         UnregisterAmbiguous(id, token1, definition.mMeta);
+         UnregisterAmbiguous(id, token2, definition.mMeta);
       }
+
+      mReclaimer.Retire(owned.release());
    }
 
    /// Get the shortest possible unambiguous token                            
    ///   @return the token                                                    
    Token Meta::GetShortestUnambiguousToken() const {
-      auto& ambiguous = Instance.GetAmbiguousMeta(mToken);
-      if (ambiguous.size() == 1)
-         return ToLastToken(mToken);
+      const auto sanitized = [this]() -> Token {
+         if (mKind == MetaKind::Data)
+            return static_cast<const MetaData*>(this)->mTokenSanitized;
+         else if (mKind == MetaKind::Trait)
+            return static_cast<const MetaTrait*>(this)->mTokenSanitized;
+         return {};
+      };
+
+      // Return the cached token, if still valid                        
+      ::std::atomic_ref<uint32_t> cache {mShortestToken};
+      const auto cached = cache.load(::std::memory_order_acquire);
+      if (cached == ShortestTokenSanitized)
+         return sanitized();
+      else if (cached != ShortestTokenNotCached)
+         return mToken.substr(cached);
+
+      // The ambiguity map might change while the token is computed,    
+      // so remember its version, to check it before caching            
+      const Reclaimer::Section section {Instance.mReclaimer};
+      const auto ambiguity = Instance.mAmbiguity.load();
+      auto& ambiguous = Instance.GetMetaList(Instance.mMetaAmbiguous, mToken, AnyBoundaryID);
+      const auto result = [&]() -> Token {
+         if (ambiguous.size() == 1)
+            return ToLastToken(mToken);
+
+         // Collect all origin types, and work with those               
+         Count datas = 0;
+         Count traits = 0;
+         MetaList origins;
+         for (auto& meta : ambiguous) {
+            const auto dmeta = meta.As<DMeta>();
+            if (dmeta and dmeta->mOrigin) {
+               origins.insert(dmeta->mOrigin);
+               ++datas;
+            }
+            else {
+               origins.insert(meta);
 
-      // Collect all origin types, and work with those                  
-      Count datas = 0;
-      Count traits = 0;
-      MetaList origins;
-      for (auto& meta : ambiguous) {
-         const auto dmeta = meta.As<DMeta>();
-         if (dmeta and dmeta->mOrigin) {
-            origins.insert(dmeta->mOrigin);
-            ++datas;
+               if (dmeta)
+                  ++datas;
+               else if (meta->mKind == MetaKind::Trait)
+                  ++traits;
+            }
          }
-         else {
-            origins.insert(meta);
 
-            if (dmeta)
-               ++datas;
-            else if (meta.Kind() == Meta::Trait)
-               ++traits;
+         // Some easy to do disambiguations                             
+         // Meta datas/traits always win over verbs/constants           
+         if (origins.size() == 1)
+            return ToLastToken(mToken);
+         else if ((datas  == 1 and traits == 0 and mKind == MetaKind::Data)
+              or  (traits == 1 and datas  == 0 and mKind == MetaKind::Trait))
+            return ToLastToken(mToken);
+         else if (datas == 1 and traits == 1) {
+            if (mKind == MetaKind::Data) {
+               // Token should be starting with a capital letter        
+               return static_cast<const MetaData*>(this)->mTokenSanitized;
+            }
+            else if (mKind == MetaKind::Trait) {
+               // Token should be starting with a lower letter          
+               return static_cast<const MetaTrait*>(this)->mTokenSanitized;
+            }
          }
-      }
 
-      // Some easy to do disambiguations                                
-      // Meta datas/traits always win over verbs/constants              
-      if (origins.size() == 1)
-         return ToLastToken(mToken);
-      else if ((datas  == 1 and traits == 0 and Kind() == Meta::Data)
-           or  (traits == 1 and datas  == 0 and Kind() == Meta::Trait))
-         return ToLastToken(mToken);
-      else if (datas == 1 and traits == 1) {
-         if (Kind() == Meta::Data) {
-            // Token should be starting with a capital letter           
-            return static_cast<const MetaData*>(this)->mTokenSanitized;
-         }
-         else if (Kind() == Meta::Trait) {
-            // Token should be starting with a lower letter             
-            return static_cast<const MetaTrait*>(this)->mTokenSanitized;
-         }
-      }
+         // Start including namespaces, until the resulting token has   
+         // exactly one match inside the ambiguous list                 
+         auto start = ToLastToken(mToken).data() - 3;
+         while (start >= mToken.data()) {
+            if (*start == ':') {
+               const auto candidate = mToken.substr(start - mToken.data() + 1);
+               Count matches = 0;
+               for (auto& meta : origins) {
+                  if (meta->mToken.ends_with(candidate)) {
+                     if (++matches > 1)
+                        break;
+                  }
+               }
 
-      // Start including namespaces, until the resulting token has      
-      // exactly one match inside the ambiguous list                    
-      auto start = ToLastToken(mToken).data() - 3;
-      while (start >= mToken.data()) {
-         if (*start == ':') {
-            const auto candidate = mToken.substr(start - mToken.data() + 1);
-            Count matches = 0;
-            for (auto& meta : origins) {
-               if (meta->mToken.ends_with(candidate)) {
-                  if (++matches > 1)
-                     break;
+               if (matches == 1) {
+                  // Match found                                        
+                  return candidate;
                }
-            }
 
-            if (matches == 1) {
-               // Match found                                           
-               return candidate;
+               start -= 2;
             }
 
-            start -= 2;
+            --start;
          }
 
-         --start;
-      }
-
-      // Full token returned as fallback                                
-      return mToken;
+         // Full token returned as fallback                             
+         return mToken;
+      }();
+
+      // Origins of the candidates might still be unknown, and nothing  
+      // resets the cache when they're assigned, so don't cache yet     
+      if (not Reflected(ambiguous))
+         return result;
+
+      // Cache it - it's either a suffix of mToken, or sanitized        
+      uint32_t computed = ShortestTokenNotCached;
+      if (result.data() >= mToken.data()
+      and result.data() + result.size() == mToken.data() + mToken.size())
+         computed = static_cast<uint32_t>(result.data() - mToken.data());
+      else if (result.data() == sanitized().data())
+         computed = ShortestTokenSanitized;
+      if (computed == ShortestTokenNotCached)
+         return result;
+
+      // If the ambiguity map changed in the meantime, the registry     
+      // might have reset the cache before it was stored, so take it    
+      // back. Otherwise any later reset is guaranteed to overwrite it  
+      cache.store(computed);
+      if (Instance.mAmbiguity.load() != ambiguity)
+         cache.compare_exchange_strong(computed, ShortestTokenNotCached);
+      return result;
    }
 
 } // namespace Langulus::RTTI
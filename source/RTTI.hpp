@@ -6,50 +6,174 @@
 /// SPDX-License-Identifier: MIT                                              
 ///                                                                           
 #pragma once
-#include "Hashing.hpp"
-#include <unordered_map>
+#include "TokenMap.hpp"
 #include <unordered_set>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <new>
 
 namespace Langulus::RTTI
 {
 
-   template<class T>
-   using BoundedMeta = ::std::unordered_map<Token, T>;
    using MetaList = ::std::unordered_set<AMeta>;
 
 
+   ///                                                                        
+   ///   Arena for the definitions of a single boundary                       
+   ///                                                                        
+   /// Definitions are placed next to each other in large chunks, instead of  
+   /// being allocated one by one. They have to be destroyed manually, but    
+   /// their memory is released all at once, when the arena is cleared or     
+   /// destroyed, which happens when their boundary is unloaded               
+   ///                                                                        
+   class MetaArena {
+      static constexpr Offset ChunkSize = 64 * 1024;
+
+      ::std::vector<::std::unique_ptr<::std::byte[]>> mChunks;
+      Offset mUsed = ChunkSize;
+
+   public:
+      /// Construct a definition inside the arena                             
+      ///   @param args - arguments for the definition's constructor          
+      ///   @return the constructed definition                                
+      template<class T, class...A>
+      NOD() T* New(A&&...args) {
+         static_assert(sizeof(T) <= ChunkSize,
+            "Definition doesn't fit in an arena chunk");
+         static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+            "Definition is overaligned for an arena chunk");
+
+         auto start = (mUsed + alignof(T) - 1) & ~(alignof(T) - 1);
+         if (start + sizeof(T) > ChunkSize) {
+            mChunks.emplace_back(new ::std::byte[ChunkSize]);
+            start = 0;
+         }
+
+         mUsed = start + sizeof(T);
+         return new (mChunks.back().get() + start) T {::std::forward<A>(args)...};
+      }
+
+      /// Destroy a definition, without releasing its memory                  
+      ///   @param meta - the definition to destroy                           
+      static void Destroy(AMeta meta) noexcept {
+         meta->~Meta();
+      }
+
+      /// Release all chunks - any definitions inside must be destroyed       
+      void Clear() noexcept {
+         mChunks.clear();
+         mUsed = ChunkSize;
+      }
+   };
+
+
    ///                                                                        
    ///   The RTTI registry                                                    
    ///                                                                        
    /// Available only if managed reflection feature is enabled                
+   /// All public functions are safe to call from multiple threads. Lookups   
+   /// never lock or wait - they search immutable snapshots, while            
+   /// registrations and unloads are serialized, and publish modified copies. 
+   /// Replaced snapshots and unloaded definitions are deleted only after all 
+   /// lookups that might still see them are done, so anything a lookup       
+   /// returns is a copy, that never refers to registry internals             
    ///                                                                        
    class Registry {
    private:
+      friend struct Meta;
+      class Transaction;
+
+      // Retires everything lookups might still see                     
+      Reclaimer mReclaimer;
+      // Serializes registrations and unloads - lookups never lock it   
+      ::std::mutex mMutex;
+      // Bumped each time a boundary is unloaded, so that any meta      
+      // pointers cached outside the registry can be invalidated        
+      ::std::atomic<Count> mEpoch = 1;
+      // Bumped each time the ambiguity map changes, so that any        
+      // disambiguations cached outside the registry can be invalidated 
+      ::std::atomic<Count> mAmbiguity = 1;
+
+      // Identifiers of interned boundaries, indexed by their names     
+      // (not case sensitive). The main boundary is interned first      
+      TokenMap<BoundaryID> mBoundaries {&mReclaimer};
+
+      // Everything a single boundary has registered, so that it can be 
+      // unloaded without sweeping through all databases. Destroys the  
+      // definitions it owns                                            
+      struct Ownership {
+         ::std::vector<CMeta> mConstants;
+         ::std::vector<DMeta> mData;
+         ::std::vector<TMeta> mTraits;
+         ::std::vector<::std::pair<Lowercase, VMeta>> mVerbs;
+         ::std::vector<Lowercase> mFiles;
+         // All the definitions above are constructed here              
+         MetaArena mArena;
+
+         Ownership() = default;
+         Ownership(Ownership&&) noexcept = default;
+         Ownership& operator = (Ownership&&) noexcept = default;
+         ~Ownership();
+      };
+
+      // Ownership records, indexed by BoundaryID                       
+      ::std::vector<Ownership> mOwnership = ::std::vector<Ownership>(1);
+
       // Database for meta data definitions                             
-      ::std::unordered_map<Lowercase, BoundedMeta<DMeta>> mMetaData;
+      TokenMap<BoundedMeta<DMeta>> mMetaData {&mReclaimer};
       // Database for named values                                      
-      ::std::unordered_map<Lowercase, BoundedMeta<CMeta>> mMetaConstants;
+      TokenMap<BoundedMeta<CMeta>> mMetaConstants {&mReclaimer};
       // Database for meta trait definitions                            
-      ::std::unordered_map<Lowercase, BoundedMeta<TMeta>> mMetaTraits;
+      TokenMap<BoundedMeta<TMeta>> mMetaTraits {&mReclaimer};
       // Database for meta verb definitions                             
-      ::std::unordered_map<Lowercase, BoundedMeta<VMeta>> mMetaVerbs;
+      TokenMap<BoundedMeta<VMeta>> mMetaVerbs {&mReclaimer};
 
       // Verbs, mapped to their original C++ class name                 
-      ::std::unordered_map<Lowercase, BoundedMeta<VMeta>> mUniqueVerbs;
+      TokenMap<BoundedMeta<VMeta>> mUniqueVerbs {&mReclaimer};
       // Database for verb definitions indexed by operator token        
-      ::std::unordered_map<Lowercase, BoundedMeta<VMeta>> mOperators;
-      // Database for ambiguous tokens                                  
-      ::std::unordered_map<Lowercase, BoundedMeta<MetaList>> mMetaAmbiguous;
+      TokenMap<BoundedMeta<VMeta>> mOperators {&mReclaimer};
+      // Symbols that share a last token in a single boundary, and how  
+      // that last token alone resolves among them, depending on its    
+      // first letter. Resolutions are remembered on first use, and     
+      // forgotten whenever a symbol is registered or unregistered,     
+      // because that publishes a modified copy, that doesn't copy them 
+      struct Symbols : MetaList {
+         mutable ::std::atomic<const Meta*> mLower = nullptr;
+         mutable ::std::atomic<const Meta*> mCapital = nullptr;
+
+         Symbols() = default;
+         Symbols(::std::initializer_list<AMeta> list)
+            : MetaList {list} {}
+         Symbols(const Symbols& other)
+            : MetaList {other} {}
+
+         Symbols& operator = (const Symbols& other) {
+            MetaList::operator = (other);
+            mLower.store(nullptr, ::std::memory_order_relaxed);
+            mCapital.store(nullptr, ::std::memory_order_relaxed);
+            return *this;
+         }
+      };
+
+      // Database for ambiguous tokens, indexed by their last token     
+      TokenMap<BoundedMeta<Symbols>> mMetaAmbiguous {&mReclaimer};
       // Meta data definitions, indexed by file extensions              
-      ::std::unordered_map<Lowercase, BoundedMeta<MetaList>> mFileDatabase;
+      TokenMap<BoundedMeta<MetaList>> mFileDatabase {&mReclaimer};
+      // Dense indices of origin data types - never reused              
+      TokenMap<::std::uint32_t> mDataIndices {&mReclaimer};
 
-      void RegisterAmbiguous(const Token&, const Lowercase&, AMeta) noexcept;
-      void UnregisterAmbiguous(const Token&, const Lowercase&, AMeta) noexcept;
-      NOD() auto GetMeta(const auto&, const Token&, const Token&) const noexcept;
-      NOD() const MetaList& GetMetaList(const auto&, const Token&, const Token&) const noexcept;
+      NOD() BoundaryID FindBoundary(const Token&) const noexcept;
+      NOD() BoundaryID InternBoundary(const Token&);
+
+      void RegisterAmbiguous(BoundaryID, const Lowercase&, AMeta);
+      void UnregisterAmbiguous(BoundaryID, const Token&, AMeta);
+      void ResetShortestTokens(const Token&) noexcept;
+      NOD() auto GetMeta(const auto&, const Token&, BoundaryID) const noexcept;
+      NOD() const auto& GetMetaList(const auto&, const Token&, BoundaryID) const noexcept;
 
       template<bool REGISTER_AMBIGUOUS = true>
-      auto Register(auto, auto&, const Lowercase&, const Token&) IF_UNSAFE(noexcept);
+      auto Register(auto, auto&, const Lowercase&, BoundaryID) IF_UNSAFE(noexcept);
 
    public:
       NOD() LANGULUS_API(RTTI)
@@ -67,8 +191,18 @@ namespace Langulus::RTTI
       LANGULUS_API(RTTI)
       void RegisterFileExtension(const Token&, DMeta, const Token&) IF_UNSAFE(noexcept);
 
+      LANGULUS_API(RTTI)
+      void RegisterAbility(VMeta, DMeta);
+
    public:
-      ~Registry();
+      Registry();
+
+      /// Get the current registry epoch                                      
+      ///   @return the epoch, that changes each time a boundary unloads      
+      NOD() LANGULUS(INLINED)
+      Count GetEpoch() const noexcept {
+         return mEpoch.load(::std::memory_order_acquire);
+      }
 
       NOD() LANGULUS_API(RTTI)
       DMeta GetMetaData(const Token&, const Token& = "") const noexcept;
@@ -86,13 +220,16 @@ namespace Langulus::RTTI
       VMeta GetOperator(const Token&, const Token& = "") const noexcept;
 
       NOD() LANGULUS_API(RTTI)
-      const MetaList& GetAmbiguousMeta(const Token&, const Token& = "") const noexcept;
+      MetaList GetAmbiguousMeta(const Token&, const Token& = "") const;
 
       NOD() LANGULUS_API(RTTI)
       AMeta DisambiguateMeta(const Token&, const Token& = "") const;
 
       NOD() LANGULUS_API(RTTI)
-      const MetaList& ResolveFileExtension(const Token&, const Token& = "") const;
+      MetaList ResolveFileExtension(const Token&, const Token& = "") const;
+
+      NOD() LANGULUS_API(RTTI)
+      ::std::uint32_t GetDataIndex(const Token&);
 
       LANGULUS_API(RTTI)
       void UnloadBoundary(const Token&);
@@ -103,6 +240,18 @@ namespace Langulus::RTTI
    ///                                                                        
    LANGULUS_API(RTTI) extern Registry Instance;
 
+   ///                                                                        
+   ///   A meta definition, cached outside the registry                       
+   ///   Stamped with the registry epoch it was retrieved in, and considered  
+   /// valid only as long as no boundary has been unloaded since. Epochs      
+   /// start at one, so a default-initialized cache is always stale           
+   ///                                                                        
+   template<class META>
+   struct MetaCache {
+      META mMeta;
+      Count mEpoch = 0;
+   };
+
    ///                                                                        
    ///   Boundary identifier, local to every shared library/executable        
    ///   It's a simple compile-time string, that is attached upon data        
@@ -142,7 +291,7 @@ namespace Langulus::RTTI
    }
 
    NOD() LANGULUS(INLINED)
-   const MetaList& GetAmbiguousMeta(const Token& token, const Token& boundary = "") noexcept {
+   MetaList GetAmbiguousMeta(const Token& token, const Token& boundary = "") {
       return Instance.GetAmbiguousMeta(token, boundary);
    }
 
@@ -152,7 +301,7 @@ namespace Langulus::RTTI
    }
 
    NOD() LANGULUS(INLINED)
-   const MetaList& ResolveFileExtension(const Token& token, const Token& boundary = "") {
+   MetaList ResolveFileExtension(const Token& token, const Token& boundary = "") {
       return Instance.ResolveFileExtension(token, boundary);
    }
 
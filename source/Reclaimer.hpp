@@ -0,0 +1,194 @@
+///                                                                           
+/// Langulus::RTTI                                                            
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Config.hpp"
+#include <vector>
+#include <atomic>
+#include <limits>
+
+
+namespace Langulus::RTTI
+{
+
+   ///                                                                        
+   ///   Epoch-based reclamation of memory, that is shared with readers       
+   ///                                                                        
+   /// Readers never lock anything - entering a read section only publishes   
+   /// the current generation in a record, that is owned by the reading       
+   /// thread. Writers are expected to be serialized externally. Instead of   
+   /// deleting unlinked memory, they retire it, and it is deleted only after 
+   /// all readers that might still see it have left their read sections      
+   ///   @attention must outlive all threads that have read through it        
+   ///                                                                        
+   class Reclaimer {
+      // Read section record, owned by a single thread at a time        
+      // Records are never deallocated before the reclaimer is, but     
+      // are reused by other threads, when their owner exits            
+      struct alignas(64) Reader {
+         // Generation the owner entered its read section in, or zero   
+         // if not inside a read section                                
+         ::std::atomic<Count> mGeneration = 0;
+         // Whether a thread currently owns the record                  
+         ::std::atomic<bool> mOwned = true;
+         // Depth of nested read sections, touched only by the owner    
+         Count mDepth = 0;
+         // Next record in the list                                     
+         Reader* mNext = nullptr;
+      };
+
+      // Memory, that can't be deleted until all readers move on        
+      struct Retired {
+         void* mMemory;
+         void (*mDelete)(void*) noexcept;
+         Count mGeneration;
+      };
+
+      // Records of the threads that ever read, that are owned by them  
+      struct Owned {
+         ::std::vector<::std::pair<const Reclaimer*, Reader*>> mRecords;
+
+         ~Owned() {
+            for (auto& record : mRecords) {
+               record.second->mGeneration.store(0, ::std::memory_order_release);
+               record.second->mOwned.store(false, ::std::memory_order_release);
+            }
+         }
+      };
+
+      // Bumped each time memory is retired                             
+      ::std::atomic<Count> mGeneration = 1;
+      // Lock-free list of all records, only ever pushed to             
+      mutable ::std::atomic<Reader*> mReaders = nullptr;
+      // Retired memory, touched only by the writer                     
+      ::std::vector<Retired> mRetired;
+
+      /// Get the record of the current thread, acquiring one on first use    
+      ///   @return the record                                                
+      Reader& Acquire() const {
+         static thread_local Owned owned;
+         for (auto& record : owned.mRecords) {
+            if (record.first == this)
+               return *record.second;
+         }
+
+         // Reuse the record of an exited thread, if possible           
+         auto reader = mReaders.load(::std::memory_order_acquire);
+         while (reader) {
+            bool expected = false;
+            if (reader->mOwned.compare_exchange_strong(expected, true))
+               break;
+            reader = reader->mNext;
+         }
+
+         if (not reader) {
+            // Push a new record to the front of the list               
+            reader = new Reader;
+            reader->mNext = mReaders.load(::std::memory_order_relaxed);
+            while (not mReaders.compare_exchange_weak(reader->mNext, reader,
+               ::std::memory_order_release, ::std::memory_order_relaxed));
+         }
+
+         owned.mRecords.emplace_back(this, reader);
+         return *reader;
+      }
+
+   public:
+      Reclaimer() = default;
+      Reclaimer(const Reclaimer&) = delete;
+      Reclaimer& operator = (const Reclaimer&) = delete;
+
+      ~Reclaimer() {
+         for (auto& retired : mRetired)
+            retired.mDelete(retired.mMemory);
+
+         auto reader = mReaders.load(::std::memory_order_acquire);
+         while (reader) {
+            const auto next = reader->mNext;
+            delete reader;
+            reader = next;
+         }
+      }
+
+      ///                                                                     
+      ///   A read section - memory seen while inside it is never deleted     
+      ///   Entering doesn't lock or wait, it only stores the current         
+      /// generation, and a fence. Sections can be nested                     
+      ///                                                                     
+      class Section {
+         Reader& mReader;
+
+      public:
+         explicit Section(const Reclaimer& reclaimer) : mReader {reclaimer.Acquire()} {
+            if (mReader.mDepth++ == 0) {
+               mReader.mGeneration.store(
+                  reclaimer.mGeneration.load(::std::memory_order_acquire),
+                  ::std::memory_order_relaxed
+               );
+
+               // Pairs with the fence in Collect - either the writer   
+               // sees this section, or this section sees the unlinks   
+               ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+            }
+         }
+
+         Section(const Section&) = delete;
+         Section& operator = (const Section&) = delete;
+
+         ~Section() {
+            if (--mReader.mDepth == 0)
+               mReader.mGeneration.store(0, ::std::memory_order_release);
+         }
+      };
+
+      /// Retire memory, that has already been unlinked from shared state     
+      ///   @attention assumes writers are serialized                         
+      ///   @param memory - the memory to delete when no reader can see it    
+      template<class T>
+      void Retire(const T* memory) {
+         if (not memory)
+            return;
+
+         mRetired.push_back({
+            const_cast<T*>(memory),
+            [](void* m) noexcept { delete static_cast<T*>(m); },
+            mGeneration.fetch_add(1, ::std::memory_order_acq_rel)
+         });
+      }
+
+      /// Delete all retired memory, that no reader can still see             
+      ///   @attention assumes writers are serialized                         
+      void Collect() noexcept {
+         if (mRetired.empty())
+            return;
+
+         // Pairs with the fence in the Section constructor             
+         ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+
+         // Memory retired before the oldest active section has begun,  
+         // could have been seen by no one                              
+         Count oldest = ::std::numeric_limits<Count>::max();
+         auto reader = mReaders.load(::std::memory_order_acquire);
+         while (reader) {
+            const auto generation = reader->mGeneration.load(::std::memory_order_relaxed);
+            if (generation and generation < oldest)
+               oldest = generation;
+            reader = reader->mNext;
+         }
+
+         Offset kept = 0;
+         for (auto& retired : mRetired) {
+            if (retired.mGeneration < oldest)
+               retired.mDelete(retired.mMemory);
+            else
+               mRetired[kept++] = retired;
+         }
+         mRetired.resize(kept);
+      }
+   };
+
+} // namespace Langulus::RTTI
@@ -184,6 +184,14 @@ namespace Langulus::RTTI
 #define LANGULUS_NULLIFIABLE() \
    public: static constexpr bool CTTI_Nullifiable = 
 
+/// You can mark types as trivially relocatable, by using                     
+/// LANGULUS(RELOCATABLE) true or false inside class. Relocatable types are   
+/// batch-moved to new memory via memmove, instead of being move-constructed  
+/// and then destroyed one by one                                             
+///   @attention the property will propagate to any derived class             
+#define LANGULUS_RELOCATABLE() \
+   public: static constexpr bool CTTI_Relocatable = 
+
 /// You can choose how a given type is pooled, if managed memory is           
 /// enabled. See RTTI::PoolTactic for options. Used only if                   
 /// LANGULUS_FEATURE(MANAGED_MEMORY) is enabled                               
@@ -447,6 +455,27 @@ namespace Langulus::CT
          else return false;
       };
 
+      /// Check if a type is trivially relocatable                            
+      ///   @tparam T - the type to check                                     
+      ///   @return true if T is trivially relocatable                        
+      template<class T>
+      consteval bool IsRelocatable() {
+         if constexpr (Complete<T>) {
+            if constexpr (not Abstract<T>) {
+               if constexpr (Dense<T> and requires { T::CTTI_Relocatable; })
+                  return T::CTTI_Relocatable;
+               else if constexpr (IsPOD<T>() or (
+               ::std::is_trivially_move_constructible_v<T> and
+               ::std::is_trivially_destructible_v<T>))
+                  return true;
+               else
+                  return false;
+            }
+            else return false;
+         }
+         else return false;
+      };
+
    } // namespace Langulus::CT::Inner
 
    /// Check if the origin T is resolvable at runtime                         
@@ -494,6 +523,15 @@ namespace Langulus::CT
    /// Use LANGULUS(NULLIFIABLE) true; as member to tag nullifiable types     
    template<class...T>
    concept Nullifiable = sizeof...(T) > 0 and (Inner::IsNullifiable<T>() and ...);
+
+   /// A trivially relocatable type is any type with a static member          
+   /// T::CTTI_Relocatable set to true. If no such member exists, the type is 
+   /// assumed relocatable only if it is POD, or if it is both trivially      
+   /// move-constructible and trivially destructible                          
+   /// Relocatable types can be moved to new memory via memmove               
+   /// Use LANGULUS(RELOCATABLE) true; as member to tag relocatable types     
+   template<class...T>
+   concept Relocatable = sizeof...(T) > 0 and (Inner::IsRelocatable<T>() and ...);
    
    /// A concretizable type is any type with a member type CTTI_Concrete      
    /// If no such member exists, the type is assumed NOT concretizable by     
@@ -0,0 +1,398 @@
+///                                                                           
+/// Langulus::RTTI                                                            
+/// Copyright (c) 2012 Dimo Markov <team@langulus.com>                        
+/// Part of the Langulus framework, see https://langulus.com                  
+///                                                                           
+/// SPDX-License-Identifier: MIT                                              
+///                                                                           
+#pragma once
+#include "Hashing.hpp"
+#include "Reclaimer.hpp"
+#include <vector>
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+
+namespace Langulus::RTTI
+{
+
+   /// Boundaries are interned by the registry into small integers, that are  
+   /// never recycled, so a reloaded library always gets its old identifier   
+   using BoundaryID = ::std::uint32_t;
+
+   /// The RTTI::MainBoundary is always interned first                        
+   constexpr BoundaryID MainBoundaryID = 0;
+   /// Used to search in any boundary, preferring the main one                
+   constexpr BoundaryID AnyBoundaryID = static_cast<BoundaryID>(-1);
+   /// Used to search in a boundary that was never interned                   
+   constexpr BoundaryID NoBoundaryID = static_cast<BoundaryID>(-2);
+
+   ///                                                                        
+   ///   Definitions of a single token, in all boundaries it's registered in  
+   ///                                                                        
+   /// Most tokens are registered in exactly one boundary, so the first entry 
+   /// is kept inline, and only the rest spill into a vector. Order of the    
+   /// entries isn't preserved on erasure                                     
+   ///                                                                        
+   template<class T>
+   class BoundedMeta {
+   public:
+      using value_type = ::std::pair<BoundaryID, T>;
+
+      template<bool CONST>
+      struct Iterator {
+         using Owner = ::std::conditional_t<CONST, const BoundedMeta, BoundedMeta>;
+         using Value = ::std::conditional_t<CONST, const value_type, value_type>;
+
+         Owner* mOwner;
+         Count mIndex;
+
+         Value& operator *  () const noexcept { return mOwner->At(mIndex); }
+         Value* operator -> () const noexcept { return &mOwner->At(mIndex); }
+
+         Iterator& operator ++ () noexcept {
+            ++mIndex;
+            return *this;
+         }
+
+         bool operator == (const Iterator&) const noexcept = default;
+      };
+
+      using iterator = Iterator<false>;
+      using const_iterator = Iterator<true>;
+
+   private:
+      Count mCount = 0;
+      value_type mFirst {};
+      ::std::vector<value_type> mSpill;
+
+   public:
+      NOD() value_type& At(Count i) noexcept {
+         return i == 0 ? mFirst : mSpill[i - 1];
+      }
+
+      NOD() const value_type& At(Count i) const noexcept {
+         return i == 0 ? mFirst : mSpill[i - 1];
+      }
+
+      NOD() Count size() const noexcept { return mCount; }
+      NOD() bool empty() const noexcept { return mCount == 0; }
+
+      NOD() iterator begin() noexcept { return {this, 0}; }
+      NOD() iterator end() noexcept { return {this, mCount}; }
+      NOD() const_iterator begin() const noexcept { return {this, 0}; }
+      NOD() const_iterator end() const noexcept { return {this, mCount}; }
+
+      /// Find the entry of a boundary                                        
+      ///   @param boundary - the boundary to search for                      
+      ///   @return the iterator to the entry, or end() if not found          
+      NOD() iterator find(BoundaryID boundary) noexcept {
+         for (Count i = 0; i < mCount; ++i) {
+            if (At(i).first == boundary)
+               return {this, i};
+         }
+         return end();
+      }
+
+      NOD() const_iterator find(BoundaryID boundary) const noexcept {
+         for (Count i = 0; i < mCount; ++i) {
+            if (At(i).first == boundary)
+               return {this, i};
+         }
+         return end();
+      }
+
+      /// Insert an entry, if its boundary isn't already present              
+      ///   @param pair - the boundary and the definition                     
+      ///   @return the iterator to the entry, and whether it was inserted    
+      ::std::pair<iterator, bool> insert(value_type&& pair) {
+         const auto found = find(pair.first);
+         if (found != end())
+            return {found, false};
+
+         if (mCount == 0)
+            mFirst = ::std::move(pair);
+         else
+            mSpill.emplace_back(::std::move(pair));
+         return {{this, mCount++}, true};
+      }
+
+      /// Erase an entry by moving the last one on its place                  
+      ///   @param it - the entry to erase                                    
+      ///   @return the iterator to the entry that took its place             
+      iterator erase(iterator it) {
+         const auto last = mCount - 1;
+         if (it.mIndex != last)
+            At(it.mIndex) = ::std::move(At(last));
+
+         if (last == 0)
+            mFirst = {};
+         else
+            mSpill.pop_back();
+         --mCount;
+         return it;
+      }
+
+      /// Erase the entry of a boundary                                       
+      ///   @param boundary - the boundary to erase                           
+      ///   @return the number of erased entries                              
+      Count erase(BoundaryID boundary) {
+         const auto found = find(boundary);
+         if (found == end())
+            return 0;
+         erase(found);
+         return 1;
+      }
+   };
+
+
+   ///                                                                        
+   ///   Open-addressing, case-insensitive map of tokens                      
+   ///                                                                        
+   /// Keys are searched by any token directly, without allocating a          
+   /// lowercase copy. Slots hold only a hash and a pointer to the entry, and 
+   /// are probed linearly, so a lookup touches the key and value only on a   
+   /// hash match.                                                            
+   ///   Searching never locks, and is safe while a single writer modifies    
+   /// the map - entries are immutable once published, and modifying one      
+   /// publishes a modified copy instead. Replaced entries and tables are     
+   /// retired in the provided reclaimer, so whatever a reader has found      
+   /// stays valid until it leaves its read section. Without a reclaimer,     
+   /// they're deleted immediately, and the map isn't shared                  
+   ///                                                                        
+   template<class V>
+   class TokenMap {
+   public:
+      using value_type = ::std::pair<Lowercase, V>;
+
+   private:
+      // Hash markers of free slots - real hashes are never below 2     
+      static constexpr size_t Empty = 0;
+      static constexpr size_t Deleted = 1;
+      static constexpr Offset MinimalCapacity = 16;
+
+      struct Slot {
+         // Case-folded hash of the key, or Empty/Deleted marker        
+         ::std::atomic<size_t> mHash = Empty;
+         // Key/value pair, published before the hash                   
+         ::std::atomic<const value_type*> mEntry = nullptr;
+      };
+
+      struct Table {
+         Offset mMask;
+         ::std::unique_ptr<Slot[]> mSlots;
+
+         explicit Table(Offset capacity)
+            : mMask {capacity - 1}
+            , mSlots {new Slot[capacity]} {}
+      };
+
+      // The current table, replaced when growing                       
+      ::std::atomic<Table*> mTable = nullptr;
+      // Where replaced entries and tables are retired, if shared       
+      Reclaimer* mReclaimer = nullptr;
+      // Number of occupied slots                                       
+      Count mCount = 0;
+      // Number of tombstones                                           
+      Count mDeleted = 0;
+
+      NOD() static size_t Fold(const Token& key) noexcept {
+         const auto h = CaseInsensitiveHash {}(key);
+         return h <= Deleted ? h + 2 : h;
+      }
+
+      /// Delete memory, once no reader can see it                            
+      template<class T>
+      void Retire(const T* memory) {
+         if (mReclaimer)
+            mReclaimer->Retire(memory);
+         else
+            delete memory;
+      }
+
+      // A slot, and the entry that was seen inside it                  
+      struct Found {
+         Slot* mSlot;
+         const value_type* mEntry;
+      };
+
+      /// Find the slot of a key                                              
+      ///   @return the slot and its entry, or nulls if key isn't in the map  
+      NOD() Found FindSlot(const Token& key, size_t hash) const noexcept {
+         const auto table = mTable.load(::std::memory_order_acquire);
+         if (not table)
+            return {};
+
+         for (auto i = hash & table->mMask; ; i = (i + 1) & table->mMask) {
+            auto& slot = table->mSlots[i];
+            const auto h = slot.mHash.load(::std::memory_order_acquire);
+            if (h == Empty)
+               return {};
+            if (h != hash)
+               continue;
+
+            // The entry might have been erased in the meantime         
+            const auto entry = slot.mEntry.load(::std::memory_order_acquire);
+            if (entry and CaseInsensitiveEqual {}(entry->first, key))
+               return {&slot, entry};
+         }
+      }
+
+      /// Make sure there's place for 'count' entries, growing if needed      
+      /// Load factor, including tombstones, never exceeds 3/4, so probing    
+      /// always ends up in an empty slot. Growing publishes a new table,     
+      /// while readers might still be probing the old one                    
+      void Reserve(Count count) {
+         const auto table = mTable.load(::std::memory_order_relaxed);
+         if (table and (count + mDeleted) * 4 <= (table->mMask + 1) * 3)
+            return;
+
+         Offset capacity = MinimalCapacity;
+         while (capacity < count * 2)
+            capacity *= 2;
+
+         const auto fresh = new Table {capacity};
+         if (table) {
+            for (Offset i = 0; i <= table->mMask; ++i) {
+               const auto h = table->mSlots[i].mHash.load(::std::memory_order_relaxed);
+               if (h <= Deleted)
+                  continue;
+
+               auto to = h & fresh->mMask;
+               while (fresh->mSlots[to].mHash.load(::std::memory_order_relaxed) != Empty)
+                  to = (to + 1) & fresh->mMask;
+               fresh->mSlots[to].mEntry.store(
+                  table->mSlots[i].mEntry.load(::std::memory_order_relaxed),
+                  ::std::memory_order_relaxed);
+               fresh->mSlots[to].mHash.store(h, ::std::memory_order_relaxed);
+            }
+         }
+
+         mTable.store(fresh, ::std::memory_order_release);
+         mDeleted = 0;
+         Retire(table);
+      }
+
+      /// Publish an entry, assuming its key is not yet in the map            
+      void Emplace(size_t hash, const value_type* entry) {
+         Reserve(mCount + 1);
+
+         const auto table = mTable.load(::std::memory_order_relaxed);
+         auto i = hash & table->mMask;
+         while (table->mSlots[i].mHash.load(::std::memory_order_relaxed) > Deleted)
+            i = (i + 1) & table->mMask;
+
+         auto& slot = table->mSlots[i];
+         if (slot.mHash.load(::std::memory_order_relaxed) == Deleted)
+            --mDeleted;
+         slot.mEntry.store(entry, ::std::memory_order_release);
+         slot.mHash.store(hash, ::std::memory_order_release);
+         ++mCount;
+      }
+
+      /// Unpublish an entry, leaving a tombstone in its place                
+      void Erase(Slot& slot) {
+         const auto entry = slot.mEntry.load(::std::memory_order_relaxed);
+         slot.mHash.store(Deleted, ::std::memory_order_release);
+         slot.mEntry.store(nullptr, ::std::memory_order_release);
+         --mCount;
+         ++mDeleted;
+         Retire(entry);
+      }
+
+   public:
+      /// Create a map                                                        
+      ///   @param reclaimer - where to retire memory if the map is shared    
+      explicit TokenMap(Reclaimer* reclaimer = nullptr) noexcept
+         : mReclaimer {reclaimer} {}
+
+      TokenMap(const TokenMap&) = delete;
+      TokenMap& operator = (const TokenMap&) = delete;
+
+      ~TokenMap() {
+         const auto table = mTable.load(::std::memory_order_relaxed);
+         if (not table)
+            return;
+
+         for (Offset i = 0; i <= table->mMask; ++i)
+            delete table->mSlots[i].mEntry.load(::std::memory_order_relaxed);
+         delete table;
+      }
+
+      NOD() Count size() const noexcept { return mCount; }
+      NOD() bool empty() const noexcept { return mCount == 0; }
+      NOD() Count capacity() const noexcept {
+         const auto table = mTable.load(::std::memory_order_relaxed);
+         return table ? table->mMask + 1 : 0;
+      }
+
+      /// Find a key, ignoring case                                           
+      ///   @attention if the map is shared, the result is valid only         
+      ///      inside the read section it was found in                        
+      ///   @param key - the key to search for                                
+      ///   @return the value, or nullptr if not found                        
+      NOD() const V* find(const Token& key) const noexcept {
+         const auto found = FindSlot(key, Fold(key));
+         return found.mEntry ? &found.mEntry->second : nullptr;
+      }
+
+      /// Insert a pair, if its key isn't already present                     
+      ///   @attention assumes writers are serialized                         
+      ///   @param pair - the key and value to insert                         
+      ///   @return the value, and whether it was inserted                    
+      ::std::pair<const V*, bool> insert(value_type&& pair) {
+         const auto hash = Fold(pair.first);
+         const auto found = FindSlot(pair.first, hash);
+         if (found.mEntry)
+            return {&found.mEntry->second, false};
+
+         const auto entry = new value_type {::std::move(pair)};
+         Emplace(hash, entry);
+         return {&entry->second, true};
+      }
+
+      /// Modify the value of a key, by publishing a modified copy of it      
+      /// Missing keys are modified starting from a default value, and        
+      /// the key is erased if the modified value ends up empty               
+      ///   @attention assumes writers are serialized                         
+      ///   @param key - the key, stored lowercased if inserted               
+      ///   @param change - the function that modifies the copy               
+      template<class F>
+      void update(const Token& key, F&& change) {
+         const auto hash = Fold(key);
+         const auto found = FindSlot(key, hash);
+         auto copy = found.mEntry
+            ? ::std::make_unique<value_type>(*found.mEntry)
+            : ::std::make_unique<value_type>(ToLowercase(key), V {});
+         change(copy->second);
+
+         if constexpr (requires (const V& v) { v.empty(); }) {
+            if (copy->second.empty()) {
+               if (found.mSlot)
+                  Erase(*found.mSlot);
+               return;
+            }
+         }
+
+         if (found.mSlot) {
+            found.mSlot->mEntry.store(copy.release(), ::std::memory_order_release);
+            Retire(found.mEntry);
+         }
+         else Emplace(hash, copy.release());
+      }
+
+      /// Erase a key, leaving a tombstone in its place                       
+      ///   @attention assumes writers are serialized                         
+      ///   @param key - the key to erase                                     
+      ///   @return the number of erased pairs                                
+      Count erase(const Token& key) {
+         const auto found = FindSlot(key, Fold(key));
+         if (not found.mSlot)
+            return 0;
+         Erase(*found.mSlot);
+         return 1;
+      }
+   };
+
+} // namespace Langulus::RTTI
@@ -272,6 +272,45 @@ SCENARIO("A complex type reflected with CTTI traits", "[metadata]") {
       REQUIRE(meta->mMembers[2].GetTrait(0) == nullptr);
       REQUIRE(meta->mMembers[2].GetType()->Is<int>());
 
+      const auto bytes = reinterpret_cast<Byte*>(&instance);
+      for (auto& member : meta->mMembers) {
+         REQUIRE(member.mOffset != Member::NoOffset);
+         REQUIRE(member.Get(bytes) == member.mValueRetriever(&instance));
+         REQUIRE(member.Get(bytes) == bytes + member.mOffset);
+      }
+
+      for (auto& member : meta->mMembers) {
+         REQUIRE(member.GetType() == member.mTypeRetriever());
+         REQUIRE(member.GetType() == member.mTypeRetriever());
+         const auto tag = member.mTraitRetriever
+            ? member.mTraitRetriever(0) : TMeta {};
+         REQUIRE(member.GetTrait(0) == tag);
+         REQUIRE(member.GetTrait(0) == tag);
+      }
+
+      const auto& table = meta->GetMemberTable();
+      REQUIRE(table.mMembers.size() == meta->GetMemberCount());
+      REQUIRE(table.mMembers.size() == meta->mMembers.size());
+      for (Offset i = 0; i < table.mMembers.size(); ++i) {
+         REQUIRE(table.mMembers[i].mMember == &meta->mMembers[i]);
+         REQUIRE(table.mMembers[i].mType == meta->mMembers[i].GetType());
+         REQUIRE(table.mMembers[i].mOffset == meta->mMembers[i].mOffset);
+      }
+
+      const auto tag = MetaTrait::Of<Traits::Tag>();
+      REQUIRE(table.mMembers[0].mTraits.size() == 1);
+      REQUIRE(table.mMembers[0].HasTrait(tag));
+      REQUIRE(meta->GetMember(tag) == &meta->mMembers[0]);
+      REQUIRE(meta->GetMember(tag, {}, 1) == nullptr);
+      REQUIRE(meta->GetMember(tag, MetaData::Of<int>()) == nullptr);
+      REQUIRE(meta->GetMember({}, MetaData::Of<int>()) == &meta->mMembers[1]);
+      REQUIRE(meta->GetMember({}, MetaData::Of<int*>()) == &meta->mMembers[2]);
+      REQUIRE(meta->GetMember({}, {}, 2) == &meta->mMembers[2]);
+      REQUIRE(meta->GetMember({}, {}, 3) == nullptr);
+      REQUIRE(meta->GetMemberCount(tag) == 1);
+      REQUIRE(meta->GetMemberCount({}, MetaData::Of<int>()) == 1);
+      REQUIRE(meta->GetMemberCount({}, {}, 1) == 2);
+
       REQUIRE(meta->mNamedValues.size() == 0);
 
       const auto intmeta = MetaData::Of<int>();
@@ -367,6 +406,27 @@ SCENARIO("A complex type reflected with CTTI traits", "[metadata]") {
    }
 }
 
+SCENARIO("Members queried while a type is still being reflected", "[metadata]") {
+   GIVEN("A type, whose member table is built before it's reflected") {
+      const auto meta = MetaData::Of<ReflectedLate>();
+      auto& generated = const_cast<MetaData&>(*meta);
+      generated.mIsReflected = false;
+      const auto& early = meta->GetMemberTable();
+      generated.mIsReflected = true;
+
+      THEN("The early table is complete, but is rebuilt on next use") {
+         REQUIRE(early.mEpoch == 0);
+         REQUIRE(early.mMembers.size() == 1);
+
+         const auto& late = meta->GetMemberTable();
+         REQUIRE(&late != &early);
+         REQUIRE(late.mEpoch != 0);
+         REQUIRE(late.mMembers.size() == 1);
+         REQUIRE(&meta->GetMemberTable() == &late);
+      }
+   }
+}
+
 SCENARIO("A simple type reflected with CTTI traits", "[metadata]") {
    WHEN("ImplicitlyReflectedData reflected") {
       auto meta = MetaData::Of<ImplicitlyReflectedData>();
@@ -518,3 +578,74 @@ SCENARIO("A reflected function signature", "[function]") {
       }
    }*/
 }
+
+TEMPLATE_TEST_CASE("Batched lifecycle functions", "[metadata]", uint32_t, std::string) {
+   using T = TestType;
+   auto meta = MetaData::Of<T>();
+   // Batched functions exist exactly when their single counterparts do 
+   // std::string isn't copy-makable by intent, so it has no copy ones  
+   REQUIRE(bool(meta->mCopyConstructorN) == bool(meta->mCopyConstructor));
+   REQUIRE(bool(meta->mMoveConstructorN) == bool(meta->mMoveConstructor));
+   REQUIRE(bool(meta->mCopyAssignerN) == bool(meta->mCopyAssigner));
+   REQUIRE(bool(meta->mMoveAssignerN) == bool(meta->mMoveAssigner));
+   REQUIRE(bool(meta->mComparerN) == bool(meta->mComparer));
+   REQUIRE(bool(meta->mDefaultConstructorN) == bool(meta->mDefaultConstructor));
+   REQUIRE(bool(meta->mDestructorN) == bool(meta->mDestructor));
+   REQUIRE(meta->mMoveConstructorN);
+   REQUIRE(meta->mMoveAssignerN);
+   REQUIRE(meta->mComparerN);
+
+   static constexpr Count count = 16;
+   const auto fill = [](T* at) {
+      for (Count i = 0; i < count; ++i) {
+         if constexpr (CT::Same<T, std::string>)
+            at[i] = std::to_string(i + 1);
+         else
+            at[i] = static_cast<T>(i + 1);
+      }
+   };
+
+   T source[count];
+   T donor[count];
+   fill(source);
+   fill(donor);
+
+   alignas(T) Byte storage[sizeof(T) * count];
+   const auto target = reinterpret_cast<T*>(storage);
+   meta->mMoveConstructorN(donor, target, count);
+   for (Count i = 0; i < count; ++i)
+      REQUIRE(target[i] == source[i]);
+   REQUIRE(meta->mComparerN(source, target, count));
+
+   if (meta->mCopyConstructorN) {
+      alignas(T) Byte copyStorage[sizeof(T) * count];
+      const auto copied = reinterpret_cast<T*>(copyStorage);
+      meta->mCopyConstructorN(source, copied, count);
+      REQUIRE(meta->mComparerN(source, copied, count));
+      if (meta->mDestructorN)
+         meta->mDestructorN(copied, count);
+   }
+
+   T changed[count] {};
+   REQUIRE_FALSE(meta->mComparerN(source, changed, count));
+   fill(donor);
+   meta->mMoveAssignerN(donor, changed, count);
+   REQUIRE(meta->mComparerN(source, changed, count));
+
+   if (meta->mCopyAssignerN) {
+      T assigned[count] {};
+      REQUIRE_FALSE(meta->mComparerN(source, assigned, count));
+      meta->mCopyAssignerN(source, assigned, count);
+      REQUIRE(meta->mComparerN(source, assigned, count));
+   }
+
+   REQUIRE(meta->mRelocatorN);
+   REQUIRE(meta->mIsTriviallyRelocatable == CT::Relocatable<T>);
+   alignas(T) Byte relocatedStorage[sizeof(T) * count];
+   const auto relocated = reinterpret_cast<T*>(relocatedStorage);
+   meta->mRelocatorN(target, relocated, count);
+   REQUIRE(meta->mComparerN(source, relocated, count));
+
+   if (meta->mDestructorN)
+      meta->mDestructorN(relocated, count);
+}
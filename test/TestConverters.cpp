@@ -38,3 +38,80 @@ TEMPLATE_TEST_CASE("Reflected from/to converters", "[metadata]",
       converter(&lhs, &rhs);
    }
 }
+
+SCENARIO("Planning conversions through other types", "[metadata]") {
+   GIVEN("Types that are convertible only through another type") {
+      const auto pimeta = MetaData::Of<Pi>();
+      const auto intmeta = MetaData::Of<int>();
+      REQUIRE_FALSE(pimeta->GetConverter(intmeta));
+
+      WHEN("A conversion is planned") {
+         const auto& plan = pimeta->GetConversionPlan(intmeta);
+
+         THEN("The shortest chain is found, and planned only once") {
+            REQUIRE(plan.IsValid());
+            REQUIRE(plan.mSteps.size() == 2);
+            REQUIRE(plan.mSteps[0].mFunction);
+            REQUIRE(plan.mSteps[1].mType->Is<int>());
+            REQUIRE(&pimeta->GetConversionPlan(intmeta) == &plan);
+
+            const Pi source = Pi::Number;
+            int converted = 0;
+            plan.Convert(&source, &converted);
+            REQUIRE(converted == 314);
+         }
+      }
+   }
+
+   GIVEN("A type and a base of its base") {
+      const auto meta = MetaData::Of<ImplicitlyReflectedDataWithTraits>();
+      const auto base = MetaData::Of<ImplicitlyReflectedData>();
+
+      WHEN("A conversion is planned") {
+         const auto& plan = meta->GetConversionPlan(base);
+
+         THEN("The base is copied out of the derived instance") {
+            REQUIRE(plan.IsValid());
+            REQUIRE(plan.mSteps.size() == 2);
+            REQUIRE_FALSE(plan.mSteps[0].mFunction);
+            REQUIRE_FALSE(plan.mSteps[1].mFunction);
+
+            ImplicitlyReflectedDataWithTraits source;
+            source.v = ImplicitlyReflectedData::Two;
+            ImplicitlyReflectedData converted;
+            plan.Convert(&source, &converted);
+            REQUIRE(converted.v == ImplicitlyReflectedData::Two);
+         }
+      }
+   }
+
+   GIVEN("Types that aren't convertible in any way") {
+      const auto meta = MetaData::Of<ImplicitlyReflectedData>();
+
+      THEN("The plan is invalid") {
+         REQUIRE_FALSE(meta->GetConversionPlan(MetaData::Of<int>()).IsValid());
+         REQUIRE_FALSE(meta->GetConversionPlan({}).IsValid());
+      }
+   }
+
+   GIVEN("A type that is converted to itself") {
+      const auto meta = MetaData::Of<ImplicitlyReflectedData>();
+
+      WHEN("A conversion is planned") {
+         const auto& plan = meta->GetConversionPlan(meta);
+
+         THEN("The instance is just copied") {
+            REQUIRE(plan.IsValid());
+            REQUIRE(plan.mSteps.size() == 1);
+            REQUIRE_FALSE(plan.mSteps[0].mFunction);
+            REQUIRE(plan.mSteps[0].mType == meta);
+
+            ImplicitlyReflectedData source;
+            source.v = ImplicitlyReflectedData::Three;
+            ImplicitlyReflectedData converted;
+            plan.Convert(&source, &converted);
+            REQUIRE(converted.v == ImplicitlyReflectedData::Three);
+         }
+      }
+   }
+}
@@ -6,6 +6,8 @@
 /// SPDX-License-Identifier: MIT                                              
 ///                                                                           
 #include "Common.hpp"
+#include <thread>
+#include <atomic>
 
 
 SCENARIO("Comparing different meta types with one another", "[meta]") {
@@ -44,6 +46,49 @@ SCENARIO("Comparing different meta types with one another", "[meta]") {
       REQUIRE(a_dmeta != a_vmeta);
       REQUIRE(a_dmeta != a_tmeta);
       REQUIRE(a_vmeta != a_tmeta);
+
+      REQUIRE(a_dmeta.Kind() == RTTI::Meta::Data);
+      REQUIRE(a_vmeta.Kind() == RTTI::Meta::Verb);
+      REQUIRE(a_tmeta.Kind() == RTTI::Meta::Trait);
+      REQUIRE(AMeta {}.Kind() == RTTI::Meta::Unknown);
+
+      REQUIRE(a_dmeta.As<DMeta>() == dmeta);
+      REQUIRE_FALSE(a_dmeta.As<TMeta>());
+      REQUIRE_FALSE(a_vmeta.As<DMeta>());
+      REQUIRE(a_tmeta.As<TMeta>() == tmeta);
+      REQUIRE_FALSE(a_tmeta.As<VMeta>());
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         const AMeta a_other = MetaDataOf<N1::Type>();
+
+         BENCHMARK_ADVANCED("AMeta::operator == (dynamic_cast)") (timer meter) {
+            const auto equal = [](const AMeta& lhs, const AMeta& rhs) {
+               if (lhs.operator -> () == rhs.operator -> ())
+                  return true;
+
+               const DMeta lhs_dmeta = dynamic_cast<const RTTI::MetaData*>(lhs.operator -> ());
+               const DMeta rhs_dmeta = dynamic_cast<const RTTI::MetaData*>(rhs.operator -> ());
+               if (lhs_dmeta and rhs_dmeta)
+                  return lhs_dmeta == rhs_dmeta;
+
+               const TMeta lhs_tmeta = dynamic_cast<const RTTI::MetaTrait*>(lhs.operator -> ());
+               const TMeta rhs_tmeta = dynamic_cast<const RTTI::MetaTrait*>(rhs.operator -> ());
+               if (lhs_tmeta and rhs_tmeta)
+                  return lhs_tmeta == rhs_tmeta;
+               return false;
+            };
+
+            meter.measure([&] {
+               return equal(a_tmeta, a_dmeta) + equal(a_dmeta, a_other);
+            });
+         };
+
+         BENCHMARK_ADVANCED("AMeta::operator == (MetaKind)") (timer meter) {
+            meter.measure([&] {
+               return (a_tmeta == a_dmeta) + (a_dmeta == a_other);
+            });
+         };
+      #endif
    }
 }
 
@@ -181,4 +226,640 @@ SCENARIO("Modifying a data type at runtime", "[meta]") {
 
       }
    }
-}
\ No newline at end of file
+}
+SCENARIO("Registering, searching and unloading from multiple threads", "[threads]") {
+   static constexpr int Writers = 4;
+   static constexpr int Readers = 4;
+   static constexpr int Iterations = 64;
+   static constexpr int TypesPerIteration = 8;
+
+   GIVEN("A set of names, that outlive the registry") {
+      static std::vector<std::string> boundaries;
+      static std::vector<std::vector<std::string>> names;
+      boundaries.resize(Writers);
+      names.resize(Writers);
+      for (int w = 0; w < Writers; ++w) {
+         boundaries[w] = "STRESS" + std::to_string(w);
+         names[w].resize(TypesPerIteration);
+         for (int t = 0; t < TypesPerIteration; ++t)
+            names[w][t] = "Stress" + std::to_string(w) + "::StressType" + std::to_string(t);
+      }
+
+      const auto expectedType = MetaDataOf<Type>();
+      const auto expectedMyType = MetaDataOf<ImplicitlyReflectedDataWithTraits>();
+      const auto epoch = RTTI::Instance.GetEpoch();
+
+      WHEN("Writers repeatedly register and unload their own boundaries, while readers search") {
+         std::atomic<bool> failed = false;
+         std::atomic<int> writersDone = 0;
+         std::vector<std::thread> threads;
+
+         for (int w = 0; w < Writers; ++w) {
+            threads.emplace_back([w, &failed, &writersDone] {
+               const Token boundary = boundaries[w];
+               for (int i = 0; i < Iterations and not failed; ++i) {
+                  for (auto& name : names[w]) {
+                     const Token token = name;
+                     if (RTTI::GetMetaData(token, boundary)
+                     or not RTTI::RegisterData(token, boundary)
+                     or not RTTI::GetMetaData(token, boundary))
+                        failed = true;
+                  }
+
+                  RTTI::RegisterFileExtension("stress",
+                     RTTI::GetMetaData(names[w][0], boundary), boundary);
+
+                  RTTI::UnloadBoundary(boundary);
+
+                  for (auto& name : names[w]) {
+                     if (RTTI::GetMetaData(name, boundary))
+                        failed = true;
+                  }
+               }
+               ++writersDone;
+            });
+         }
+
+         for (int r = 0; r < Readers; ++r) {
+            threads.emplace_back([&] {
+               // Lists are shared by all writers, so they keep changing
+               // while being copied and iterated                       
+               const auto check = [&](const RTTI::MetaList& list) {
+                  if (list.size() > Writers)
+                     failed = true;
+                  for (auto& meta : list) {
+                     if (not meta)
+                        failed = true;
+                  }
+               };
+
+               while (writersDone < Writers and not failed) {
+                  if (RTTI::GetMetaData("Type") != expectedType
+                  or RTTI::DisambiguateMeta("MyType") != expectedMyType
+                  or not RTTI::GetMetaTrait("Tag")
+                  or not RTTI::GetOperator("+"))
+                     failed = true;
+
+                  check(RTTI::GetAmbiguousMeta("StressType0"));
+                  check(RTTI::ResolveFileExtension("stress"));
+               }
+            });
+         }
+
+         for (auto& thread : threads)
+            thread.join();
+
+         THEN("No lookup ever observed a partially modified registry") {
+            REQUIRE_FALSE(failed);
+            REQUIRE(writersDone == Writers);
+
+            for (int w = 0; w < Writers; ++w) {
+               for (auto& name : names[w])
+                  REQUIRE_FALSE(RTTI::GetMetaData(name));
+            }
+
+            REQUIRE(RTTI::GetMetaData("Type") == expectedType);
+            REQUIRE(RTTI::DisambiguateMeta("MyType") == expectedMyType);
+            REQUIRE(RTTI::GetAmbiguousMeta("StressType0").empty());
+            REQUIRE(RTTI::ResolveFileExtension("stress").empty());
+         }
+
+         THEN("Each unload invalidated the cached definitions") {
+            REQUIRE(RTTI::Instance.GetEpoch() == epoch + Writers * Iterations);
+            REQUIRE(MetaDataOf<Type>() == expectedType);
+            REQUIRE(MetaDataOf<ImplicitlyReflectedDataWithTraits>() == expectedMyType);
+         }
+      }
+   }
+}
+
+SCENARIO("Searching the registry by long tokens", "[lookup]") {
+   GIVEN("A long token of a registered type, in a different case") {
+      static constexpr Token token = "Langulus::Anyness::TMany<Langulus::Anyness::Text>";
+      static constexpr Token query = "LANGULUS::ANYNESS::TMANY<LANGULUS::ANYNESS::TEXT>";
+      const auto meta = RTTI::RegisterData(token, "LOOKUP");
+
+      WHEN("Searched for") {
+         THEN("Case is ignored") {
+            REQUIRE(RTTI::GetMetaData(query) == meta);
+            REQUIRE(RTTI::GetMetaData(query, "LOOKUP") == meta);
+            REQUIRE_FALSE(RTTI::GetMetaData(query, "MAIN"));
+         }
+
+         #ifdef LANGULUS_STD_BENCHMARK
+            BENCHMARK_ADVANCED("Registry::GetMetaData") (timer meter) {
+               meter.measure([&] {
+                  return RTTI::GetMetaData(query);
+               });
+            };
+
+            BENCHMARK_ADVANCED("std::unordered_map::find(ToLowercase(token))") (timer meter) {
+               std::unordered_map<Lowercase, DMeta> baseline;
+               baseline[ToLowercase(token)] = meta;
+               meter.measure([&] {
+                  return baseline.find(ToLowercase(query));
+               });
+            };
+
+            BENCHMARK_ADVANCED("RTTI::TokenMap::find(token)") (timer meter) {
+               RTTI::TokenMap<DMeta> transparent;
+               (void) transparent.insert({ToLowercase(token), meta});
+               meter.measure([&] {
+                  return transparent.find(query);
+               });
+            };
+         #endif
+      }
+
+      RTTI::UnloadBoundary("LOOKUP");
+      REQUIRE_FALSE(RTTI::GetMetaData(query));
+   }
+}
+
+#ifdef LANGULUS_STD_BENCHMARK
+/// Allocator that tracks the number of bytes allocated by std containers     
+inline size_t AllocatedBytes = 0;
+
+template<class T>
+struct CountingAllocator {
+   using value_type = T;
+
+   CountingAllocator() = default;
+   template<class U>
+   CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+   T* allocate(size_t n) {
+      AllocatedBytes += n * sizeof(T);
+      return std::allocator<T> {}.allocate(n);
+   }
+
+   void deallocate(T* p, size_t n) noexcept {
+      AllocatedBytes -= n * sizeof(T);
+      std::allocator<T> {}.deallocate(p, n);
+   }
+
+   template<class U>
+   bool operator == (const CountingAllocator<U>&) const noexcept { return true; }
+};
+
+SCENARIO("Registry database footprint and lookup latency", "[lookup]") {
+   using Inner = std::unordered_map<Token, DMeta, std::hash<Token>, std::equal_to<Token>,
+      CountingAllocator<std::pair<const Token, DMeta>>>;
+   using Baseline = std::unordered_map<Lowercase, Inner, std::hash<Lowercase>, std::equal_to<Lowercase>,
+      CountingAllocator<std::pair<const Lowercase, Inner>>>;
+   using Flat = RTTI::TokenMap<RTTI::BoundedMeta<DMeta>>;
+
+   for (size_t count : {10'000, 100'000, 1'000'000}) {
+      GIVEN(std::to_string(count) + " registered tokens, each in a single boundary") {
+         std::vector<std::string> tokens(count);
+         for (size_t i = 0; i < count; ++i)
+            tokens[i] = "type" + std::to_string(i);
+
+         const auto before = AllocatedBytes;
+         Baseline baseline;
+         for (auto& token : tokens)
+            baseline[token].insert({"MAIN", nullptr});
+         const auto baselineBytes = AllocatedBytes - before;
+
+         Flat flat;
+         for (auto& token : tokens) {
+            flat.update(token, [](auto& bounded) {
+               bounded.insert({RTTI::MainBoundaryID, nullptr});
+            });
+         }
+         const auto flatBytes = flat.capacity()
+            * (sizeof(size_t) + sizeof(typename Flat::value_type*))
+            + flat.size() * sizeof(typename Flat::value_type);
+
+         WARN("std::unordered_map footprint: " << baselineBytes << " bytes");
+         WARN("RTTI::TokenMap footprint: " << flatBytes << " bytes");
+
+         BENCHMARK_ADVANCED("std::unordered_map<Lowercase, std::unordered_map<Token, DMeta>>") (timer meter) {
+            meter.measure([&](int i) {
+               auto& inner = baseline.find(tokens[i % count])->second;
+               return inner.find("MAIN")->second;
+            });
+         };
+
+         BENCHMARK_ADVANCED("RTTI::TokenMap<RTTI::BoundedMeta<DMeta>>") (timer meter) {
+            meter.measure([&](int i) {
+               auto& inner = *flat.find(tokens[i % count]);
+               return inner.find(RTTI::MainBoundaryID)->second;
+            });
+         };
+      }
+   }
+}
+#endif
+
+SCENARIO("Unloading a small boundary from a large registry", "[unload]") {
+   static constexpr int LargeCount = 100'000;
+   static constexpr int SmallCount = 16;
+
+   GIVEN("A large boundary, and a small one") {
+      static std::vector<std::string> large;
+      static std::vector<std::string> small;
+      large.resize(LargeCount);
+      small.resize(SmallCount);
+      for (int i = 0; i < LargeCount; ++i)
+         large[i] = "Large::Type" + std::to_string(i);
+      for (int i = 0; i < SmallCount; ++i)
+         small[i] = "Small::Type" + std::to_string(i);
+
+      for (auto& name : large)
+         (void) RTTI::RegisterData(name, "LARGE");
+
+      const auto registerSmall = [] {
+         for (auto& name : small)
+            (void) RTTI::RegisterData(name, "SMALL");
+         RTTI::RegisterFileExtension("small", RTTI::GetMetaData(small[0]), "SMALL");
+      };
+
+      WHEN("The small boundary is unloaded") {
+         registerSmall();
+         REQUIRE(RTTI::ResolveFileExtension("small").size() == 1);
+         RTTI::UnloadBoundary("SMALL");
+
+         THEN("Only its definitions are gone") {
+            for (auto& name : small)
+               REQUIRE_FALSE(RTTI::GetMetaData(name));
+            REQUIRE(RTTI::ResolveFileExtension("small").empty());
+            REQUIRE(RTTI::GetMetaData(large.front()));
+            REQUIRE(RTTI::GetMetaData(large.back()));
+         }
+
+         #ifdef LANGULUS_STD_BENCHMARK
+            BENCHMARK_ADVANCED("Register and unload a small boundary") (timer meter) {
+               meter.measure([&] {
+                  registerSmall();
+                  RTTI::UnloadBoundary("SMALL");
+               });
+            };
+         #endif
+      }
+
+      RTTI::UnloadBoundary("LARGE");
+      REQUIRE_FALSE(RTTI::GetMetaData(large.front()));
+   }
+}
+
+SCENARIO("Shortest unambiguous tokens follow registrations", "[ambiguity]") {
+   GIVEN("A type with a unique last token") {
+      const auto a = RTTI::RegisterData("Alpha::Shortest", "SHORTEST");
+      REQUIRE(a.GetToken() == "Shortest");
+      REQUIRE(a.GetToken() == "Shortest");
+
+      WHEN("Another type with the same last token is registered") {
+         const auto b = RTTI::RegisterData("Beta::Shortest", "SHORTEST");
+
+         THEN("Both tokens get qualified") {
+            REQUIRE(a.GetToken() == "Alpha::Shortest");
+            REQUIRE(b.GetToken() == "Beta::Shortest");
+         }
+      }
+
+      RTTI::UnloadBoundary("SHORTEST");
+   }
+}
+
+SCENARIO("Disambiguated keywords follow registrations", "[ambiguity]") {
+   GIVEN("A type with a unique last token") {
+      const auto a = RTTI::RegisterData("Alpha::Resolved", "RESOLVED");
+      REQUIRE(RTTI::DisambiguateMeta("Resolved") == a);
+      REQUIRE(RTTI::DisambiguateMeta("Resolved") == a);
+
+      WHEN("Another type with the same last token is registered") {
+         const auto b = RTTI::RegisterData("Beta::Resolved", "RESOLVED");
+
+         THEN("The short keyword becomes ambiguous") {
+            REQUIRE_THROWS(RTTI::DisambiguateMeta("Resolved"));
+            REQUIRE(RTTI::DisambiguateMeta("Alpha::Resolved") == a);
+            REQUIRE(RTTI::DisambiguateMeta("beta::resolved") == b);
+            REQUIRE(RTTI::DisambiguateMeta("beta::resolved", "RESOLVED") == b);
+            REQUIRE_THROWS(RTTI::DisambiguateMeta("beta::resolved", "MAIN"));
+         }
+      }
+
+      RTTI::UnloadBoundary("RESOLVED");
+      REQUIRE_THROWS(RTTI::DisambiguateMeta("Resolved"));
+   }
+
+   #ifdef LANGULUS_STD_BENCHMARK
+      GIVEN("Keywords, as a script parser would encounter them") {
+         static constexpr int Count = 64;
+         static std::vector<std::string> names;
+         std::vector<std::string> keywords;
+         for (int i = 0; i < Count; ++i) {
+            const auto name = "Keyword" + std::to_string(i);
+            names.emplace_back("Parser::" + name);
+            names.emplace_back("Script::" + name);
+            keywords.emplace_back("Parser::" + name);
+            keywords.emplace_back("script::" + name);
+         }
+
+         for (auto& name : names)
+            (void) RTTI::RegisterData(name, "PARSER");
+
+         BENCHMARK_ADVANCED("Registry::DisambiguateMeta (1M keywords)") (timer meter) {
+            meter.measure([&] {
+               AMeta last;
+               for (int i = 0; i < 1'000'000; ++i)
+                  last = RTTI::DisambiguateMeta(keywords[i % keywords.size()]);
+               return last;
+            });
+         };
+
+         RTTI::UnloadBoundary("PARSER");
+      }
+   #endif
+}
+
+SCENARIO("Comparing definitions of the same type from different boundaries", "[meta]") {
+   GIVEN("A type reflected in two boundaries") {
+      const auto a = RTTI::RegisterData("Canon::Type", "CANON1");
+      const auto b = RTTI::RegisterData("Canon::Type", "CANON2");
+      const auto c = RTTI::RegisterData("Canon::Other", "CANON2");
+      REQUIRE(a.operator -> () != b.operator -> ());
+
+      THEN("Both definitions share the same canonical definition") {
+         REQUIRE(a->GetCanonical() == a.operator -> ());
+         REQUIRE(b->GetCanonical() == a.operator -> ());
+         REQUIRE(c->GetCanonical() == c.operator -> ());
+         REQUIRE(a->IsExact(b));
+         REQUIRE(b->IsExact(a));
+         REQUIRE_FALSE(a->IsExact(c));
+         REQUIRE_FALSE(b->IsExact(c));
+      }
+
+      WHEN("The boundary of the canonical definition is unloaded") {
+         RTTI::UnloadBoundary("CANON1");
+
+         THEN("The surviving definition becomes canonical") {
+            REQUIRE(b->GetCanonical() == b.operator -> ());
+            REQUIRE(RTTI::GetMetaData("Canon::Type") == b);
+            REQUIRE(b->IsExact(RTTI::GetMetaData("Canon::Type")));
+            REQUIRE_FALSE(b->IsExact(c));
+         }
+      }
+
+      RTTI::UnloadBoundary("CANON1");
+      RTTI::UnloadBoundary("CANON2");
+      REQUIRE_FALSE(RTTI::GetMetaData("Canon::Type"));
+   }
+}
+
+SCENARIO("Dispatching verbs through frozen ability tables", "[verbs]") {
+   GIVEN("A type with a reflected ability") {
+      const auto meta = MetaData::Of<ImplicitlyReflectedDataWithTraits>();
+      const auto create = MetaVerb::Of<Verbs::Create>();
+      const auto& ability = meta->mAbilities.at(create);
+
+      THEN("Default overloads are found without allocating signatures") {
+         REQUIRE(meta->mAbilityTable.mEntries.size() == 1);
+         REQUIRE(meta->GetAbility<true>(create, {})
+            == ability.mOverloadsMutable.at({}));
+         REQUIRE(meta->GetAbility<false>(create, {})
+            == ability.mOverloadsConstant.at({}));
+         REQUIRE(meta->GetAbility<true>(create, MetaData::Of<int>())
+            == ability.mOverloadsMutable.at({}));
+         REQUIRE(meta->GetAbility<true, Verbs::Create>(MetaData::Of<int>())
+            == ability.mOverloadsMutable.at({}));
+      }
+
+      THEN("Types without the ability dispatch nothing") {
+         const auto other = MetaData::Of<int>();
+         REQUIRE_FALSE(other->GetAbility<true>(create, {}));
+         REQUIRE_FALSE(other->GetAbility<false>(create, {}));
+      }
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         const auto argument = MetaData::Of<int>();
+
+         BENCHMARK_ADVANCED("MetaData::GetAbility (1M dispatches)") (timer meter) {
+            meter.measure([&] {
+               FVerbMutable last {};
+               for (int i = 0; i < 1'000'000; ++i)
+                  last = meta->GetAbility<true>(create, argument);
+               return last;
+            });
+         };
+
+         BENCHMARK_ADVANCED("std::unordered_map<Signature> (1M dispatches)") (timer meter) {
+            meter.measure([&] {
+               FVerbMutable last {};
+               for (int i = 0; i < 1'000'000; ++i) {
+                  const auto found = meta->mAbilities.find(create);
+                  auto foundo = found->second.mOverloadsMutable.find({argument});
+                  if (foundo == found->second.mOverloadsMutable.end())
+                     foundo = found->second.mOverloadsMutable.find({});
+                  last = foundo->second;
+               }
+               return last;
+            });
+         };
+      #endif
+   }
+}
+
+SCENARIO("Resolving overloads with multiple arguments", "[verbs]") {
+   GIVEN("An ability with overloads for related argument types") {
+      static int dispatched = 0;
+      const auto base = MetaData::Of<ImplicitlyReflectedData>();
+      const auto convertible = MetaData::Of<ConvertibleData>();
+      const auto derived = MetaData::Of<ImplicitlyReflectedDataWithTraits>();
+      const auto integer = MetaData::Of<int>();
+
+      const FVerbMutable fallback = [](void*, Flow::Verb&) { dispatched = 1; };
+      const FVerbMutable onBase = [](void*, Flow::Verb&) { dispatched = 2; };
+      const FVerbMutable onConvertible = [](void*, Flow::Verb&) { dispatched = 3; };
+      const FVerbMutable onPair = [](void*, Flow::Verb&) { dispatched = 4; };
+
+      RTTI::Ability ability;
+      ability.mVerb = MetaVerb::Of<Verbs::Create>();
+      ability.mOverloadsMutable[{}] = fallback;
+      ability.mOverloadsMutable[{base}] = onBase;
+      ability.mOverloadsMutable[{convertible}] = onConvertible;
+      ability.mOverloadsMutable[{base, integer}] = onPair;
+
+      const auto resolve = [&](::std::vector<DMeta> arguments) {
+         return ability.Resolve<true>(arguments.data(), arguments.size());
+      };
+
+      THEN("Exact matches are preferred") {
+         REQUIRE(resolve({base}) == onBase);
+         REQUIRE(resolve({convertible}) == onConvertible);
+         REQUIRE(resolve({}) == fallback);
+      }
+
+      THEN("Derived arguments pick the overload of their closest base") {
+         REQUIRE(resolve({derived}) == onConvertible);
+         REQUIRE(resolve({derived, integer}) == onPair);
+         REQUIRE(resolve({convertible, integer}) == onPair);
+      }
+
+      THEN("Arguments that only convert are accepted last") {
+         REQUIRE(resolve({MetaData::Of<Pi>()}) == onConvertible);
+      }
+
+      THEN("Anything else falls back to the default overload") {
+         REQUIRE(resolve({integer}) == fallback);
+         REQUIRE(resolve({integer, base}) == fallback);
+         REQUIRE(resolve({base, integer, integer}) == fallback);
+         REQUIRE(ability.Resolve<false>(nullptr, 0) == nullptr);
+      }
+   }
+
+   GIVEN("A type with a reflected ability") {
+      const auto meta = MetaData::Of<ImplicitlyReflectedDataWithTraits>();
+      const auto create = MetaVerb::Of<Verbs::Create>();
+      const auto fallback = meta->GetAbility<true>(create, {});
+      const DMeta arguments[] {MetaData::Of<int>(), MetaData::Of<float>()};
+
+      WHEN("The same signature is resolved repeatedly") {
+         const auto first = meta->ResolveAbility<true>(create, arguments, 2);
+         const auto hits = RTTI::OverloadCache::GetHits();
+         const auto second = meta->ResolveAbility<true>(create, arguments, 2);
+
+         THEN("Only the first resolution ranks the overloads") {
+            REQUIRE(first == fallback);
+            REQUIRE(second == first);
+            REQUIRE(RTTI::OverloadCache::GetHits() == hits + 1);
+            REQUIRE(meta->GetAbility<true, Verbs::Create, int, float>() == first);
+         }
+      }
+   }
+}
+
+SCENARIO("Finding all types capable of a verb", "[verbs]") {
+   GIVEN("A verb") {
+      const auto create = MetaVerb::Of<Verbs::Create>();
+      const auto able = MetaData::Of<ImplicitlyReflectedDataWithTraits>();
+
+      THEN("Types with the reflected ability are indexed in the verb") {
+         REQUIRE(create->mAble.contains(able));
+         REQUIRE_FALSE(create->mAble.contains(MetaData::Of<int>()));
+         const auto& types = create->mAble.load();
+         REQUIRE(std::is_sorted(types.begin(), types.end(),
+            [](const DMeta& lhs, const DMeta& rhs) {
+               return std::less<const MetaData*> {}(
+                  lhs.operator -> (), rhs.operator -> ());
+            }));
+
+         for (auto& type : types)
+            REQUIRE(type->IsAbleTo(create));
+      }
+
+      WHEN("The boundary of a capable type is unloaded") {
+         const auto temporary = RTTI::RegisterData("Able::Type", "ABLE");
+         const_cast<MetaData&>(*temporary).mAbilities.emplace(create, RTTI::Ability {});
+         const auto before = create->mAble.size();
+         RTTI::Instance.RegisterAbility(create, temporary);
+         RTTI::Instance.RegisterAbility(create, temporary);
+         const auto count = create->mAble.size();
+         REQUIRE(count == before + 1);
+         REQUIRE(create->mAble.contains(temporary));
+         RTTI::UnloadBoundary("ABLE");
+
+         THEN("The type is erased from the verb") {
+            REQUIRE(create->mAble.size() == count - 1);
+            REQUIRE(create->mAble.contains(able));
+         }
+      }
+   }
+}
+
+SCENARIO("Dispatching verbs through inline-cached sites", "[verbs]") {
+   GIVEN("A dispatch site for a verb") {
+      const auto create = MetaVerb::Of<Verbs::Create>();
+      const auto able = MetaData::Of<ImplicitlyReflectedDataWithTraits>();
+      const auto unable = MetaData::Of<int>();
+      RTTI::DispatchSite<true, 2> site {create};
+
+      WHEN("The same receiver is dispatched repeatedly") {
+         const auto first = site.Get(able);
+         const auto second = site.Get(able);
+
+         THEN("Only the first dispatch searches the ability table") {
+            REQUIRE(first);
+            REQUIRE(first == able->GetAbility<true>(create, {}));
+            REQUIRE(second == first);
+            REQUIRE(site.GetMisses() == 1);
+            REQUIRE(site.GetHits() == 1);
+         }
+      }
+
+      WHEN("More receivers than the site remembers are dispatched") {
+         REQUIRE(site.Get(able));
+         REQUIRE_FALSE(site.Get(unable));
+         REQUIRE_FALSE(site.Get(MetaData::Of<float>()));
+         REQUIRE(site.Get(able));
+
+         THEN("The oldest one gets replaced") {
+            REQUIRE(site.GetCount() == 2);
+            REQUIRE(site.GetMisses() == 4);
+            REQUIRE(site.GetHits() == 0);
+         }
+      }
+
+      WHEN("A boundary is unloaded between dispatches") {
+         REQUIRE(site.Get(able));
+         (void) RTTI::RegisterData("Dispatch::Type", "DISPATCH");
+         RTTI::UnloadBoundary("DISPATCH");
+         REQUIRE(site.Get(able));
+
+         THEN("The site forgets everything it remembered") {
+            REQUIRE(site.GetMisses() == 2);
+            REQUIRE(site.GetHits() == 0);
+         }
+      }
+   }
+
+   #ifdef LANGULUS_STD_BENCHMARK
+      GIVEN("Call sites, each dispatching to a number of receiver types") {
+         const auto create = MetaVerb::Of<Verbs::Create>();
+         const DMeta receivers[] {
+            MetaData::Of<ImplicitlyReflectedDataWithTraits>(),
+            MetaData::Of<ImplicitlyReflectedData>(),
+            MetaData::Of<ConvertibleData>(),
+            MetaData::Of<Complex>(),
+            MetaData::Of<bool>(),
+            MetaData::Of<char>(),
+            MetaData::Of<int8_t>(),
+            MetaData::Of<uint8_t>(),
+            MetaData::Of<int16_t>(),
+            MetaData::Of<uint16_t>(),
+            MetaData::Of<int32_t>(),
+            MetaData::Of<uint32_t>(),
+            MetaData::Of<int64_t>(),
+            MetaData::Of<uint64_t>(),
+            MetaData::Of<float>(),
+            MetaData::Of<double>()
+         };
+
+         const auto dispatch = [&](auto& site, int types) {
+            FVerbMutable last {};
+            for (int i = 0; i < 1'000'000; ++i)
+               last = site.Get(receivers[i % types]);
+            return last;
+         };
+
+         for (int types : {1, 2, 4, 16}) {
+            const auto suffix = " (" + std::to_string(types) + " types, 1M dispatches)";
+
+            BENCHMARK_ADVANCED("DispatchSite<4>::Get" + suffix) (timer meter) {
+               RTTI::DispatchSite<true, 4> site {create};
+               meter.measure([&] { return dispatch(site, types); });
+            };
+
+            BENCHMARK_ADVANCED("MetaData::GetAbility" + suffix) (timer meter) {
+               meter.measure([&] {
+                  FVerbMutable last {};
+                  for (int i = 0; i < 1'000'000; ++i)
+                     last = receivers[i % types]->GetAbility<true>(create, {});
+                  return last;
+               });
+            };
+         }
+      }
+   #endif
+}
@@ -220,6 +220,45 @@ TEMPLATE_TEST_CASE("Testing not CT::POD<T>", "[concepts]",
 
 //TODO Nullifiable
 
+///                                                                           
+/// CT::Relocatable                                                           
+///                                                                           
+TEMPLATE_TEST_CASE("Testing CT::Relocatable<T>", "[concepts]",
+   ImplicitlyConstructible,
+   bool, uint32_t, double, char, wchar_t, char8_t, Langulus::Byte,
+   ForcefullyPod,
+   ForcefullyRelocatable,
+   AggregateType
+) {
+   static_assert(CT::Relocatable<TestType>);
+   static_assert(CT::Relocatable<TestType*>);
+
+   auto meta = MetaData::Of<TestType>();
+   REQUIRE(meta);
+   REQUIRE(meta->mIsTriviallyRelocatable);
+}
+
+TEMPLATE_TEST_CASE("Testing not CT::Relocatable<T>", "[concepts]",
+   Complex,
+   ContainsComplex,
+   IncompleteType,
+   AggregateTypeComplex
+) {
+   static_assert(not CT::Relocatable<TestType>);
+   static_assert(    CT::Relocatable<TestType*>);
+
+   if constexpr (CT::Complete<TestType>) {
+      auto meta = MetaData::Of<TestType>();
+      REQUIRE(meta);
+      REQUIRE_FALSE(meta->mIsTriviallyRelocatable);
+   }
+
+   // Pointers are relocatable, even if the origin type isn't           
+   auto sparse = MetaData::Of<TestType*>();
+   REQUIRE(sparse);
+   REQUIRE(sparse->mIsTriviallyRelocatable);
+}
+
 ///                                                                           
 /// CT::Reflectable                                                           
 ///                                                                           
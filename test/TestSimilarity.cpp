@@ -6,6 +6,7 @@
 /// SPDX-License-Identifier: MIT                                              
 ///                                                                           
 #include "Common.hpp"
+#include <thread>
 
 
 /// A freestanding type compatibility check                                   
@@ -565,3 +566,129 @@ TEST_CASE("MetaData::IsExact", "[is]") {
       }
    }
 }
+
+SCENARIO("Querying bases of deep and wide hierarchies", "[metadata]") {
+   GIVEN("A deep hierarchy") {
+      const auto deep = MetaData::Of<DeepBase<16>>();
+      const auto root = MetaData::Of<DeepBase<0>>();
+
+      REQUIRE(deep->HasBase(root));
+      REQUIRE(deep->HasBase<DeepBase<8>>());
+      REQUIRE_FALSE(root->HasBase(deep));
+      REQUIRE(root->HasDerivation(deep));
+
+      RTTI::Base base;
+      REQUIRE(deep->GetBase(root, 0, base));
+      REQUIRE(base.mType == root);
+      REQUIRE(base.mOffset == 0);
+      REQUIRE(base.mBinaryCompatible);
+      REQUIRE_FALSE(deep->GetBase(root, 1, base));
+      REQUIRE(deep->CastsTo<DeepBase<0>, true>());
+
+      // Asking again is answered by the relation cache                 
+      const auto hits = RTTI::RelationCache::GetHits();
+      const auto misses = RTTI::RelationCache::GetMisses();
+      REQUIRE(deep->CastsTo<DeepBase<0>, true>());
+      REQUIRE(RTTI::RelationCache::GetHits() == hits + 1);
+      REQUIRE(RTTI::RelationCache::GetMisses() == misses);
+
+      // Other threads count in their own tables, but are summed, too   
+      bool casts[2] {};
+      std::thread {[&] {
+         casts[0] = deep->CastsTo<DeepBase<0>, true>();
+         casts[1] = deep->CastsTo<DeepBase<0>, true>();
+      }}.join();
+      REQUIRE(casts[0]);
+      REQUIRE(casts[1]);
+      REQUIRE(RTTI::RelationCache::GetHits() >= hits + 2);
+      REQUIRE(RTTI::RelationCache::GetMisses() >= misses + 1);
+      REQUIRE(deep->GetDistanceTo(root) == 16);
+      REQUIRE(deep->IsRelatedTo(root));
+      REQUIRE(root->IsRelatedTo(deep));
+
+      // Distances to many candidates at once                           
+      const DMeta candidates[] {
+         root, MetaData::Of<DeepBase<8>>(), deep, MetaData::Of<Wide>(),
+         MetaData::Of<const DeepBase<15>*>()
+      };
+      MetaData::Distance distances[std::size(candidates)];
+      deep->GetDistancesTo(candidates, std::size(candidates), distances);
+      REQUIRE(distances[0] == 16);
+      REQUIRE(distances[1] == 8);
+      REQUIRE(distances[2] == 0);
+      REQUIRE(distances[3] == MetaData::Distance::Infinite);
+      REQUIRE(distances[4] == 1);
+      REQUIRE(root->mIndex != deep->mIndex);
+      REQUIRE(MetaData::Of<DeepBase<16>*>()->mIndex == deep->mIndex);
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("MetaData::HasBase (16 levels)") (timer meter) {
+            meter.measure([&] {
+               return deep->HasBase(root);
+            });
+         };
+
+         BENCHMARK_ADVANCED("MetaData::GetBase (16 levels)") (timer meter) {
+            meter.measure([&] {
+               return deep->GetBase(root, 0, base);
+            });
+         };
+
+         BENCHMARK_ADVANCED("MetaData::GetDistancesTo (5 candidates)") (timer meter) {
+            meter.measure([&] {
+               deep->GetDistancesTo(candidates, std::size(candidates), distances);
+               return distances[0];
+            });
+         };
+      #endif
+   }
+
+   GIVEN("A wide hierarchy") {
+      const auto wide = MetaData::Of<Wide>();
+      const auto last = MetaData::Of<WideBase<7>>();
+
+      REQUIRE(wide->HasBase(last));
+      REQUIRE_FALSE(wide->HasBase<DeepBase<0>>());
+      REQUIRE_FALSE(last->HasBase(wide));
+      REQUIRE(last->HasDerivation(wide));
+      REQUIRE_FALSE(wide->HasDerivation(last));
+      REQUIRE(wide->Is(MetaData::Of<const Wide*>()));
+      REQUIRE_FALSE(wide->Is(last));
+
+      RTTI::Base base;
+      REQUIRE(wide->GetBase(last, 0, base));
+      REQUIRE(base.mType == last);
+      REQUIRE(base.mOffset == 7 * sizeof(int));
+      REQUIRE_FALSE(base.mBinaryCompatible);
+      REQUIRE_FALSE(wide->CastsTo<WideBase<7>, true>());
+      REQUIRE(wide->CastsTo<WideBase<7>, false>());
+
+      #ifdef LANGULUS_STD_BENCHMARK
+         BENCHMARK_ADVANCED("MetaData::HasBase (8 bases)") (timer meter) {
+            meter.measure([&] {
+               return wide->HasBase(last);
+            });
+         };
+
+         BENCHMARK_ADVANCED("MetaData::HasBase (unrelated)") (timer meter) {
+            const auto unrelated = MetaData::Of<DeepBase<0>>();
+            meter.measure([&] {
+               return wide->HasBase(unrelated);
+            });
+         };
+
+         BENCHMARK_ADVANCED("MetaData::Is (through a pointer)") (timer meter) {
+            const auto sparse = MetaData::Of<const Wide*>();
+            meter.measure([&] {
+               return wide->Is(sparse);
+            });
+         };
+
+         BENCHMARK_ADVANCED("MetaData::CastsTo (8 bases)") (timer meter) {
+            meter.measure([&] {
+               return wide->CastsTo<WideBase<7>, true>();
+            });
+         };
+      #endif
+   }
+}
@@ -354,6 +354,11 @@ class ForcefullyPod {
    Complex mData;
 };
 
+class ForcefullyRelocatable {
+   LANGULUS(RELOCATABLE) true;
+   Complex mData;
+};
+
 struct Type {};
 
 struct TypeErasedContainer {
@@ -442,4 +447,37 @@ struct CloneConstructibleButNotAssignable {
    CloneConstructibleButNotAssignable(Cloned<CloneConstructibleButNotAssignable>&& a) : m {a->m} {}
    CloneConstructibleButNotAssignable& operator = (const CloneConstructibleButNotAssignable&) = delete;
    CloneConstructibleButNotAssignable& operator = (CloneConstructibleButNotAssignable&&) = delete;
+};
+
+/// A deep chain of bases, each binary compatible with the next one           
+template<int N>
+struct DeepBase : DeepBase<N - 1> {
+   LANGULUS_BASES(DeepBase<N - 1>);
+};
+
+template<>
+struct DeepBase<0> {
+   int member;
+};
+
+/// A type with many direct bases, laid one after another                     
+template<int N>
+struct WideBase {
+   int member;
+};
+
+struct Wide : WideBase<0>, WideBase<1>, WideBase<2>, WideBase<3>,
+              WideBase<4>, WideBase<5>, WideBase<6>, WideBase<7> {
+   LANGULUS_BASES(
+      WideBase<0>, WideBase<1>, WideBase<2>, WideBase<3>,
+      WideBase<4>, WideBase<5>, WideBase<6>, WideBase<7>
+   );
+};
+
+/// Its members are queried in tests before it's marked as reflected          
+struct ReflectedLate {
+   int member;
+
+   using Self = ReflectedLate;
+   LANGULUS_MEMBERS(&Self::member);
 };
\ No newline at end of file